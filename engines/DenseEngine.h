@@ -0,0 +1,473 @@
+#ifndef DENSE_ENGINE_H
+#define DENSE_ENGINE_H
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "./Engine.h"
+#include "../structures/BoardInput.h"
+#include "../constants.h"
+
+using namespace std;
+using namespace Constants;
+
+/// @brief Validates if the cell is inside the grid.
+/// @param neighbRow the line the neighbor is on
+/// @param neighbCol the column the neighbor is on
+/// @param size the number of rows and columns in the square grid
+/// @return true if the input indices of neighbour cell exist inside the bound of rows and columns of the grid else false
+inline bool isValidCell(int neighbRow, int neighbCol, const int size)
+{
+    return (static_cast<unsigned>(neighbRow) < static_cast<unsigned>(size)) &
+           (static_cast<unsigned>(neighbCol) < static_cast<unsigned>(size));
+}
+
+/// @brief Calculates the number of alive neighbouring cells for the particular cell at the given position.
+/// @param grid John Conway's Game of Life ( The grid )
+/// @param currRow the line on which the rules apply
+/// @param currCol the column on which the rules apply
+/// @return the number of alive neighbouring cells
+inline int getNeighboursAlive(const vector<vector<int>> &grid, const int currRow, const int currCol)
+{
+    const int coordinatesNeighbors[8][2] = {
+        {-1, -1}, // Left Up
+        {-1, 0},  // Mid Up
+        {-1, 1},  // Right Up
+        {0, -1},  // Left Mid
+        {0, 1},   // Right Mid
+        {1, -1},  // Down Left
+        {1, 0},   // Down Mid
+        {1, 1}    // Down Right
+    };
+    const int size = grid.size();
+    int neighboursAlive = 0;
+    const int coordinatesNeighborsSize = 8;
+    for (int neighbor = 0; neighbor < coordinatesNeighborsSize; neighbor++)
+    {
+        const int neighbRow = currRow + coordinatesNeighbors[neighbor][0];
+        const int neighbCol = currCol + coordinatesNeighbors[neighbor][1];
+        if (isValidCell(neighbRow, neighbCol, size))
+        {
+            neighboursAlive += grid[neighbRow][neighbCol] == LIVE;
+        }
+    }
+    return neighboursAlive;
+}
+
+/// @brief The rules of the Game of Life (B3/S23): the status of a cell in the next generation.
+/// @param state the current status of the cell
+/// @param neighboursAlive the number of alive neighbouring cells
+/// @return the status of the cell
+inline char applyRules(const int state, const int neighboursAlive)
+{
+    return state ? ((neighboursAlive > 1 && neighboursAlive < 4) ? LIVE : DEAD) : ((neighboursAlive == 3) ? LIVE : DEAD);
+}
+
+/// @brief Calculates the status of the cell at the given indices for the next generation by checking the number of alive neighbouring cells.
+/// @param grid John Conway's Game of Life ( The grid )
+/// @param currRow the line on which the rules apply
+/// @param currCol the column on which the rules apply
+/// @return the status of the cell
+inline char getCurrentState(const vector<vector<int>> &grid, const int currRow, const int currCol)
+{
+    return applyRules(grid[currRow][currCol], getNeighboursAlive(grid, currRow, currCol));
+}
+
+/// @brief Updates the grid with the new status of each cell from the next generation.
+/// @param grid John Conway's Game of Life ( The grid )
+/// @param nextGrid next generation of John Conway's Game of Life ( The grid )
+inline void updateGrid(vector<vector<int>> &grid, const vector<vector<int>> &nextGrid)
+{
+    const int size = grid.size();
+    for (int row = 0; row < size; row++)
+    {
+        for (int col = 0; col < size; col++)
+        {
+            grid[row][col] = nextGrid[row][col];
+        }
+    }
+}
+
+/// @brief Creates a new grid based on the current grid by applying rules of the Game of Life.
+/// This is the reference kernel every engine is checked against.
+/// @param grid John Conway's Game of Life ( The grid )
+/// @return the new grid based on the current grid by applying rules
+inline vector<vector<int>> getNextGrid(vector<vector<int>> &grid)
+{
+    static vector<vector<int>> nextGrid;
+    const int size = grid.size();
+    if (static_cast<int>(nextGrid.size()) != size)
+    {
+        nextGrid.assign(size, vector<int>(size));
+    }
+    for (int i = 0; i < size * size; ++i)
+    {
+        const int row = i / size;
+        const int col = i % size;
+        nextGrid[row][col] = getCurrentState(grid, row, col);
+    }
+    return nextGrid;
+}
+
+/// @brief Returns a list of elements that represent the lines and columns that will be cleaned.
+/// @param size the maximum number of rows or columns
+/// @return the list of elements that will be cleaned
+inline vector<int> toBeCleaned(const int size)
+{
+    return vector<int>{0, 1, size - 2, size - 1};
+}
+
+/// @brief Cleans all the columns of the grid that are marked as "to be cleaned" with value 0.
+/// @param grid John Conway's Game of Life ( The grid )
+inline void cleanCols(vector<vector<int>> &grid)
+{
+    const int size = grid.size();
+    vector<int> colsToBeCleaned = toBeCleaned(size);
+    for (int row = 0; row < size; ++row)
+    {
+        for (auto &colToBeCleaned : colsToBeCleaned)
+        {
+            grid[row][colToBeCleaned] = 0;
+        }
+    }
+}
+
+/// @brief Cleans all the rows of the grid that are marked as "to be cleaned" with value 0.
+/// @param grid John Conway's Game of Life ( The grid )
+inline void cleanRows(vector<vector<int>> &grid)
+{
+    const int size = grid.size();
+    vector<int> rowsToBeCleaned = toBeCleaned(size);
+    for (int col = 0; col < size; ++col)
+    {
+        for (auto &rowToBeCleaned : rowsToBeCleaned)
+        {
+            grid[rowToBeCleaned][col] = 0;
+        }
+    }
+}
+
+/// @brief Zero out all values ​​in the specific rows and columns of the grid.
+/// @param grid John Conway's Game of Life ( The grid )
+inline void cleanIt(vector<vector<int>> &grid)
+{
+    cleanRows(grid);
+    cleanCols(grid);
+}
+
+/// @brief Check if there is a value of 1 on the added border, on the top or bottom border.
+/// @param grid John Conway's Game of Life ( The grid )
+/// @return true if top or bottom border contains a value of 1 else false
+inline bool isOnTopOrBottomBorder(vector<vector<int>> &grid)
+{
+    const int size = grid.size();
+    for (int row = 0; row < size; ++row)
+    {
+        if (grid[row][0] == 1 || grid[row][size - 1] == 1)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// @brief Check if there is a value of 1 on the added border, on the left or right border.
+/// @param grid John Conway's Game of Life ( The grid )
+/// @return true if left or right border contains a value of 1 else false
+inline bool isOnLeftOrRightBorder(vector<vector<int>> &grid)
+{
+    const int size = grid.size();
+    for (int col = 0; col < size; ++col)
+    {
+        if (grid[0][col] == 1 || grid[size - 1][col] == 1)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// @brief Checks if there is a one on any of the borders of the grid.
+/// @param grid John Conway's Game of Life ( The grid )
+/// @return true if left or right border contains a value of 1 else false
+inline bool isOneOnBorder(vector<vector<int>> &grid)
+{
+    if (isOnTopOrBottomBorder(grid))
+        return true;
+    return isOnLeftOrRightBorder(grid);
+}
+
+/// @brief Zero out all values in the border rows and columns of the grid if border contains one.
+/// @param grid John Conway's Game of Life ( The grid )
+inline void cleanBoarder(vector<vector<int>> &grid)
+{
+    if (isOneOnBorder(grid))
+        cleanIt(grid);
+}
+
+/// @brief Counts the live cells inside a rectangle of the grid and finds their bounding box.
+/// @param grid John Conway's Game of Life ( The grid )
+/// @param generation the generation number
+/// @param firstRow, lastRow, firstCol, lastCol the scanned rectangle (inclusive), all live cells must be inside it
+/// @return the statistics of the current generation, without births and deaths
+inline GenerationStats computeStats(const vector<vector<int>> &grid, const int generation, const int firstRow, const int lastRow, const int firstCol, const int lastCol)
+{
+    GenerationStats stats;
+    stats.generation = generation;
+    for (int row = firstRow; row <= lastRow; ++row)
+    {
+        int rowFirstCol = -1, rowLastCol = -1;
+        for (int col = firstCol; col <= lastCol; ++col)
+        {
+            if (grid[row][col] == LIVE)
+            {
+                stats.population++;
+                rowFirstCol = rowFirstCol < 0 ? col : rowFirstCol;
+                rowLastCol = col;
+            }
+        }
+        if (rowLastCol >= 0)
+        {
+            stats.includeRow(row, rowFirstCol, rowLastCol);
+        }
+    }
+    return stats;
+}
+
+/// @brief Counts the live cells of the grid and finds their bounding box with a full scan, used once after loading.
+/// @param grid John Conway's Game of Life ( The grid )
+/// @return the statistics of generation 0
+inline GenerationStats computeStats(const vector<vector<int>> &grid)
+{
+    const int size = grid.size();
+    return computeStats(grid, 0, 0, size - 1, 0, size - 1);
+}
+
+/// @brief Advances the grid by one generation and computes its census in the same pass.
+/// Only the bounding box of the live cells, grown by one cell, is scanned, since no cell further away can be born,
+/// and the bounding box also replaces the border scan of `cleanBoarder`.
+/// @param grid John Conway's Game of Life ( The grid )
+/// @param nextGrid scratch grid of the same size, only the scanned rectangle is written
+/// @param stats the statistics of the current generation, replaced by the ones of the next generation
+inline void nextGeneration(vector<vector<int>> &grid, vector<vector<int>> &nextGrid, GenerationStats &stats)
+{
+    const int size = grid.size();
+    GenerationStats next;
+    next.generation = stats.generation + 1;
+    if (stats.empty())
+    {
+        stats = next;
+        return;
+    }
+
+    const int firstRow = max(stats.minRow - 1, 0);
+    const int lastRow = min(stats.maxRow + 1, size - 1);
+    const int firstCol = max(stats.minCol - 1, 0);
+    const int lastCol = min(stats.maxCol + 1, size - 1);
+    for (int row = firstRow; row <= lastRow; ++row)
+    {
+        int rowFirstCol = -1, rowLastCol = -1;
+        for (int col = firstCol; col <= lastCol; ++col)
+        {
+            const int cell = getCurrentState(grid, row, col);
+            const int previous = grid[row][col];
+            nextGrid[row][col] = cell;
+            next.population += cell;
+            next.births += cell && !previous;
+            next.deaths += !cell && previous;
+            if (cell)
+            {
+                rowFirstCol = rowFirstCol < 0 ? col : rowFirstCol;
+                rowLastCol = col;
+            }
+        }
+        if (rowLastCol >= 0)
+        {
+            next.includeRow(row, rowFirstCol, rowLastCol);
+        }
+    }
+    // A live cell is on the outermost ring exactly when the bounding box touches it; `cleanBoarder` then clears the border,
+    // and the cleared cells are compared with the current generation so a cell born on the border counts as neither birth nor death.
+    if (!next.empty() && (next.minRow == 0 || next.minCol == 0 || next.maxRow == size - 1 || next.maxCol == size - 1))
+    {
+        for (int row = firstRow; row <= lastRow; ++row)
+        {
+            const bool borderRow = row < BORDER_SIZE || row >= size - BORDER_SIZE;
+            for (int col = firstCol; col <= lastCol; ++col)
+            {
+                if (nextGrid[row][col] == LIVE && (borderRow || col < BORDER_SIZE || col >= size - BORDER_SIZE))
+                {
+                    next.births -= !grid[row][col];
+                    next.deaths += grid[row][col];
+                    nextGrid[row][col] = DEAD;
+                }
+            }
+        }
+        const GenerationStats cleaned = computeStats(nextGrid, next.generation, next.minRow, next.maxRow, next.minCol, next.maxCol);
+        next.population = cleaned.population;
+        next.minRow = cleaned.minRow;
+        next.minCol = cleaned.minCol;
+        next.maxRow = cleaned.maxRow;
+        next.maxCol = cleaned.maxCol;
+    }
+    for (int row = firstRow; row <= lastRow; ++row)
+    {
+        copy(nextGrid[row].begin() + firstCol, nextGrid[row].begin() + lastCol + 1, grid[row].begin() + firstCol);
+    }
+    stats = next;
+}
+
+/// @brief Simulates the whole grid with `nextGeneration` and returns the requested window, used when the light cone of the window reaches the border.
+/// @param grid John Conway's Game of Life ( The grid )
+/// @param region the window to return, without the added border
+/// @param generation the number of generations to simulate
+/// @return the window at the requested generation
+inline vector<vector<int>> queryFullGrid(vector<vector<int>> grid, const Region &region, const int generation)
+{
+    vector<vector<int>> nextGrid = grid;
+    GenerationStats stats = computeStats(grid);
+    for (int step = 0; step < generation && !stats.empty(); step++)
+    {
+        nextGeneration(grid, nextGrid, stats);
+    }
+    vector<vector<int>> window(region.height, vector<int>(region.width));
+    for (int row = 0; row < region.height; ++row)
+    {
+        for (int col = 0; col < region.width; ++col)
+        {
+            window[row][col] = grid[region.y0 + BORDER_SIZE + row][region.x0 + BORDER_SIZE + col];
+        }
+    }
+    return window;
+}
+
+/// @brief Computes a window of the grid at a given generation by evolving only its light cone:
+/// the window expanded by one cell per remaining generation, shrinking by one cell on every side after each step.
+/// Falls back to the full simulation when the cone reaches the border, since `cleanBoarder` depends on the whole grid.
+/// @param grid John Conway's Game of Life ( The grid )
+/// @param region the window to return, without the added border
+/// @param generation the number of generations to simulate
+/// @return the window at the requested generation
+inline vector<vector<int>> queryRegion(const vector<vector<int>> &grid, const Region &region, const int generation)
+{
+    const int size = grid.size();
+    const int innerSize = size - 2 * BORDER_SIZE;
+    if (region.empty() || region.x0 < 0 || region.y0 < 0 || static_cast<long long>(region.x0) + region.width > innerSize ||
+        static_cast<long long>(region.y0) + region.height > innerSize)
+    {
+        throw runtime_error("The query region is outside of the grid");
+    }
+    // A cone wider than the grid always reaches the border; checking this first keeps the cone arithmetic below within int.
+    if (generation >= innerSize)
+    {
+        return queryFullGrid(grid, region, generation);
+    }
+
+    const int coneRow = region.y0 + BORDER_SIZE - generation;
+    const int coneCol = region.x0 + BORDER_SIZE - generation;
+    const int coneRows = region.height + 2 * generation;
+    const int coneCols = region.width + 2 * generation;
+    if (coneRow < BORDER_SIZE || coneCol < BORDER_SIZE || coneRow + coneRows > size - BORDER_SIZE || coneCol + coneCols > size - BORDER_SIZE)
+    {
+        return queryFullGrid(grid, region, generation);
+    }
+
+    vector<vector<int>> cone(coneRows, vector<int>(coneCols));
+    for (int row = 0; row < coneRows; ++row)
+    {
+        copy_n(grid[coneRow + row].begin() + coneCol, coneCols, cone[row].begin());
+    }
+
+    // After `step` generations only cells at least `step` cells away from the cone edge are still exact.
+    // Those cells have all their neighbours inside the cone, so they are counted directly instead of through the bounds checks of `getNeighboursAlive`.
+    vector<vector<int>> nextCone = cone;
+    for (int step = 1; step <= generation; ++step)
+    {
+        for (int row = step; row < coneRows - step; ++row)
+        {
+            for (int col = step; col < coneCols - step; ++col)
+            {
+                const int neighboursAlive = cone[row - 1][col - 1] + cone[row - 1][col] + cone[row - 1][col + 1] +
+                                            cone[row][col - 1] + cone[row][col + 1] +
+                                            cone[row + 1][col - 1] + cone[row + 1][col] + cone[row + 1][col + 1];
+                nextCone[row][col] = applyRules(cone[row][col], neighboursAlive);
+            }
+        }
+        swap(cone, nextCone);
+    }
+
+    vector<vector<int>> window(region.height, vector<int>(region.width));
+    for (int row = 0; row < region.height; ++row)
+    {
+        copy_n(cone[generation + row].begin() + generation, region.width, window[row].begin());
+    }
+    return window;
+}
+
+/// @brief The engine of the sequential program: one `int` per cell, stepped by `nextGeneration` over the bounding box of the live cells.
+/// Window queries are answered from the light cone of the window (`queryRegion`).
+class DenseEngine : public Engine
+{
+public:
+    bool load(const string &inputData) override
+    {
+        bool denseInput;
+        readBoard(
+            inputData, denseInput,
+            [&](const int size)
+            { _grid.assign(size + 2 * BORDER_SIZE, vector<int>(size + 2 * BORDER_SIZE, DEAD)); },
+            [&](const int row, const int col)
+            { _grid[row + BORDER_SIZE][col + BORDER_SIZE] = LIVE; });
+        _nextGrid = _grid;
+        _stats = computeStats(_grid);
+        return denseInput;
+    }
+
+    int size() const override
+    {
+        return max(0, static_cast<int>(_grid.size()) - 2 * BORDER_SIZE);
+    }
+
+    void step(int generations) override
+    {
+        while (generations-- > 0)
+        {
+            nextGeneration(_grid, _nextGrid, _stats);
+        }
+    }
+
+    void readRegion(const Region &region, vector<char> &out) override
+    {
+        out.resize(static_cast<size_t>(region.height) * region.width);
+        for (int row = 0; row < region.height; ++row)
+        {
+            const vector<int> &cells = _grid[region.y0 + BORDER_SIZE + row];
+            copy_n(cells.begin() + region.x0 + BORDER_SIZE, region.width, out.begin() + static_cast<size_t>(row) * region.width);
+        }
+    }
+
+    GenerationStats statistics() override
+    {
+        return _stats;
+    }
+
+    /// @brief Evolves only the light cone of the window, the board is left at the current generation.
+    void queryRegion(const Region &region, const int generations, vector<char> &out) override
+    {
+        const vector<vector<int>> window = ::queryRegion(_grid, region, generations);
+        out.resize(static_cast<size_t>(region.height) * region.width);
+        for (int row = 0; row < region.height; ++row)
+        {
+            copy(window[row].begin(), window[row].end(), out.begin() + static_cast<size_t>(row) * region.width);
+        }
+    }
+
+private:
+    vector<vector<int>> _grid;
+    vector<vector<int>> _nextGrid;
+    GenerationStats _stats;
+};
+
+#endif
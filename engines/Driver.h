@@ -0,0 +1,344 @@
+#ifndef DRIVER_H
+#define DRIVER_H
+
+// The header files for input-output operations, string operations, file operations and timing have been included.
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <filesystem>
+#include <algorithm>
+#include <stdexcept>
+
+#include "./EngineRegistry.h"
+#include "../structures/Data.h"
+#include "../structures/FrameExporter.h"
+#include "../utils.h"
+#include "../constants.h"
+
+using namespace std;
+using namespace chrono;
+using namespace Constants;
+namespace fs = filesystem;
+
+/// The command-line program shared by every variant: `<input> <generations> [--engine=<name>] [options]`.
+/// The variants only differ by their default engine; everything else (input, output files, statistics, frames, timing) is done here,
+/// on the root process only when the engine is distributed.
+
+/// @brief Gives the engines access to the `--<name>=<value>` options of the command line.
+inline EngineOptions commandLineOptions(int argc, char **argv)
+{
+    return [argc, argv](const string &name, const string &defaultValue)
+    { return getOption(argc, argv, name, defaultValue); };
+}
+
+/// @brief Takes command-line input arguments from the user
+/// @param argc the number of arguments entered on the command line
+/// @param argv the arguments entered on the command line
+/// @return the input filename (if present) or 'null' (if not), and the number of generations.
+inline pair<string, int> getInputData(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        return make_pair("null", 0);
+    }
+    return make_pair(argv[1], stoi(argv[2]));
+}
+
+/// @brief Reads the optional `--query=x0,y0,width,height` command-line argument.
+/// @param argc the number of arguments entered on the command line
+/// @param argv the arguments entered on the command line
+/// @return the requested window, empty if the argument is missing
+/// @throws runtime_error if the argument is present but not four comma-separated integers
+inline Region getQueryRegion(int argc, char **argv)
+{
+    Region region;
+    const string query = getOption(argc, argv, "query");
+    if (query.empty())
+    {
+        return region;
+    }
+    char separators[3] = {};
+    istringstream iss(query);
+    iss >> region.x0 >> separators[0] >> region.y0 >> separators[1] >> region.width >> separators[2] >> region.height;
+    if (iss.fail() || iss.peek() != char_traits<char>::eof() || count(begin(separators), end(separators), ',') != 3)
+    {
+        throw runtime_error("Invalid --query=" + query + ", expected x0,y0,width,height");
+    }
+    return region;
+}
+
+/// @brief Prepares the structure containing the options of the run.
+/// @param argc the number of arguments entered on the command line
+/// @param argv the arguments entered on the command line
+/// @param defaultEngine the engine used when `--engine` is missing
+/// @return the input data filename, the number of generations, the engine name, the query region and the frame export options
+inline Data prepareGameOfLife(int argc, char **argv, const string &defaultEngine)
+{
+    Data configuration;
+    auto [inputFilename, numGenerations] = getInputData(argc, argv);
+    configuration.inputFilename = inputFilename;
+    configuration.numGenerations = numGenerations;
+    configuration.engine = getOption(argc, argv, "engine", defaultEngine);
+    configuration.denseInput = true;
+    if (inputFilename == "null")
+    {
+        return configuration;
+    }
+    configuration.query = getQueryRegion(argc, argv);
+    configuration.frames = getFrameOptions(argc, argv);
+    return configuration;
+}
+
+/// @brief If it meets specific criteria, it saves the current generation of the board to a file.
+/// Boards read from the dense format are written as the `0`/`1` string of the grid without its border,
+/// boards read from the sparse format are written as a row-major list of `row,col` live cells.
+/// @param configuration the input data filename, the number of generations and the input format
+/// @param engine the engine holding the board
+/// @param generation the generation number
+/// @return true if the current generation is saved else false
+inline bool saveCurrentGeneration(const Data &configuration, Engine &engine, int generation)
+{
+    const int size = engine.size();
+    if (size <= 2 * BORDER_SIZE)
+    {
+        return false;
+    }
+
+    ofstream outfile;
+    if (engine.isRoot())
+    {
+        const string folderName = "output/";
+        if (!fs::exists(folderName))
+        {
+            fs::create_directory(folderName);
+        }
+        const string filePath = folderName + configuration.inputFilename + "_" + to_string(configuration.numGenerations) + ".txt";
+        outfile.open(filePath, ios::app);
+        if (!outfile)
+        {
+            throw runtime_error("Could not open " + filePath);
+        }
+        outfile << generation << ": ";
+    }
+
+    if (configuration.denseInput)
+    {
+        const int band = 64;
+        vector<char> cells;
+        string digits;
+        for (int firstRow = 0; firstRow < size; firstRow += band)
+        {
+            engine.readRegion(Region{0, firstRow, size, min(band, size - firstRow)}, cells);
+            if (!engine.isRoot())
+                continue;
+            digits.resize(cells.size());
+            for (size_t i = 0; i < cells.size(); ++i)
+            {
+                digits[i] = '0' + cells[i];
+            }
+            outfile << digits;
+        }
+    }
+    else
+    {
+        vector<pair<int, int>> liveCells;
+        engine.forEachLive([&](const int row, const int col)
+                           { if (engine.isRoot()) liveCells.emplace_back(row, col); });
+        sort(liveCells.begin(), liveCells.end());
+        for (const auto &[row, col] : liveCells)
+        {
+            outfile << row << "," << col << " ";
+        }
+    }
+    if (engine.isRoot())
+    {
+        outfile << endl;
+    }
+    return true;
+}
+
+/// @brief Saves the window computed by `Engine::queryRegion` to a file, in the same layout as `saveCurrentGeneration`.
+/// @param configuration the input data filename, the number of generations and the query region
+/// @param window the window at the requested generation
+/// @return true if the window is saved else false
+inline bool saveQueryRegion(const Data &configuration, const vector<char> &window)
+{
+    const string folderName = "output/";
+    if (!fs::exists(folderName))
+    {
+        fs::create_directory(folderName);
+    }
+
+    const Region &region = configuration.query;
+    const string fileExtension = ".txt";
+    const string outputFilename = configuration.inputFilename + "_" + to_string(configuration.numGenerations) + "_query_" +
+                                  to_string(region.x0) + "_" + to_string(region.y0) + "_" + to_string(region.width) + "_" + to_string(region.height);
+    const string filePath = folderName + outputFilename + fileExtension;
+
+    ofstream outfile(filePath);
+    if (!outfile)
+    {
+        return false;
+    }
+
+    outfile << configuration.numGenerations << ": ";
+    for (const char cell : window)
+    {
+        outfile << static_cast<int>(cell);
+    }
+    outfile << endl;
+    return true;
+}
+
+/// @brief Simulates the Game of Life for a given number of generations, updates and saves the board on each generation.
+/// With `--frames`, each generation is exported as a downsampled image instead of a line of text.
+/// The population, births, deaths and bounding box of every generation, computed by the step itself, are saved in `statistics/`.
+/// @param configuration the input data filename, the number of generations, the layout of the output and the frame export options
+/// @param engine the engine holding the first generation
+inline void saveGameOfLife(const Data &configuration, Engine &engine)
+{
+    ofstream statistics;
+    unique_ptr<FrameExporter> exporter;
+    if (engine.isRoot())
+    {
+        statistics = openStatisticsFile(configuration.inputFilename, configuration.numGenerations);
+        if (configuration.frames.enabled())
+        {
+            exporter = make_unique<FrameExporter>(configuration.frames, configuration.inputFilename + "_" + to_string(configuration.numGenerations));
+        }
+    }
+    for (int generation = 0; generation < configuration.numGenerations; generation++)
+    {
+        if (configuration.frames.enabled())
+        {
+            // Reading the board is collective, the other processes of a distributed engine take part without keeping anything.
+            if (exporter)
+                exporter->push(engine, generation);
+            else
+                engine.forEachLive([](int, int) {});
+        }
+        else if (!saveCurrentGeneration(configuration, engine, generation))
+        {
+            continue;
+        }
+        const GenerationStats stats = engine.statistics();
+        if (engine.isRoot())
+        {
+            saveGenerationStats(statistics, stats);
+        }
+        engine.step(1);
+    }
+}
+
+/// @brief Simulates the Game of Life for a given number of generations and updates the board on each generation.
+/// @param configuration the number of generations
+/// @param engine the engine holding the first generation
+inline void playGameOfLife(const Data &configuration, Engine &engine)
+{
+    engine.step(configuration.numGenerations);
+    const string summary = engine.summary();
+    if (engine.isRoot() && !summary.empty())
+    {
+        cout << summary << "\n";
+    }
+}
+
+/// @brief Runs the program on an engine: loads the input, then either answers `--query` or saves every generation and times a plain run.
+inline int simulateGameOfLife(int argc, char **argv, const string &defaultEngine)
+{
+    vector<high_resolution_clock::time_point> timePoints;
+
+    timePoints.emplace_back(high_resolution_clock::now());
+    Data configuration = prepareGameOfLife(argc, argv, defaultEngine);
+    unique_ptr<Engine> engine = createEngine(configuration.engine, commandLineOptions(argc, argv));
+    if (configuration.inputFilename == "null")
+    {
+        if (engine->isRoot())
+        {
+            cout << "The number of arguments is not correct\n";
+            cout << "Game of life did not complete successfully";
+        }
+        return 0;
+    }
+    if (engine->isRoot())
+    {
+        setSysStdout(configuration.inputFilename, configuration.numGenerations);
+    }
+    const string inputData = engine->isRoot() ? readFile(configuration.inputFilename) : "";
+    configuration.denseInput = engine->load(inputData);
+
+    if (!configuration.query.empty())
+    {
+        timePoints.emplace_back(high_resolution_clock::now());
+        vector<char> window;
+        engine->queryRegion(configuration.query, configuration.numGenerations, window);
+        timePoints.emplace_back(high_resolution_clock::now());
+        if (engine->isRoot())
+        {
+            saveQueryRegion(configuration, window);
+            cout << "Function queryRegion = " << duration_cast<nanoseconds>(timePoints[2] - timePoints[1]).count() * 1e-9 << " seconds\n";
+            cout << "Game of life completed successfully";
+        }
+        return 0;
+    }
+
+    timePoints.emplace_back(high_resolution_clock::now());
+    saveGameOfLife(configuration, *engine);
+
+    timePoints.emplace_back(high_resolution_clock::now());
+    // The plain run starts from the first generation again; reloading it is not part of the measurement.
+    engine->load(inputData);
+    const high_resolution_clock::time_point reloaded = high_resolution_clock::now();
+    playGameOfLife(configuration, *engine);
+
+    timePoints.emplace_back(high_resolution_clock::now() - (reloaded - timePoints[2]));
+    if (engine->isRoot())
+    {
+        measureExecutionTime(timePoints);
+        cout << "Engine = " << configuration.engine << "\n";
+        cout << "Game of life completed successfully";
+    }
+    return 0;
+}
+
+/// @brief The `main` of every variant. Programs compiled with `-DHAVE_MPI` initialise MPI around the run, so `--engine=mpi` can be used.
+/// @param defaultEngine the engine used when `--engine` is missing
+inline int runGameOfLife(int argc, char **argv, const string &defaultEngine)
+{
+#ifdef HAVE_MPI
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+#endif
+    int status = 0;
+    try
+    {
+        status = simulateGameOfLife(argc, argv, defaultEngine);
+    }
+    catch (const exception &error)
+    {
+        cout << error.what() << "\n";
+        cout << "Game of life did not complete successfully";
+        status = 1;
+#ifdef HAVE_MPI
+        // The other ranks may be waiting in a collective call the failing rank will never reach (e.g. rank 0 could not read the input),
+        // so the whole job is stopped instead of finalising this rank alone.
+        int ranks;
+        MPI_Comm_size(MPI_COMM_WORLD, &ranks);
+        if (ranks > 1)
+        {
+            cout << endl;
+            MPI_Abort(MPI_COMM_WORLD, status);
+        }
+#endif
+    }
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+    return status;
+}
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+#include "../structures/Region.h"
+#include "../structures/GenerationStats.h"
+#include "../constants.h"
+
+using namespace std;
+
+/// @brief A Game of Life backend. Every backend simulates the same bordered grid with the same rules (cells outside the grid are dead,
+/// and the two outer rows and columns are cleared as soon as a live cell reaches the outermost one), so backends can be swapped
+/// with `--engine=<name>` and compared on the same inputs.
+/// Distributed backends are collective: every process calls every method in the same order, and only the root process gets the data.
+class Engine
+{
+public:
+    virtual ~Engine() = default;
+
+    /// @brief Replaces the board with the one described by the content of an input file (see `readBoard`), at generation 0.
+    /// Only the input given to the root process is used.
+    /// @return true when the input used the dense format
+    virtual bool load(const string &inputData) = 0;
+
+    /// @brief The number of rows and columns of the (square) board, without the added border.
+    virtual int size() const = 0;
+
+    /// @brief Advances the board by `generations` generations.
+    virtual void step(int generations) = 0;
+
+    /// @brief Copies a window of the board into `out` (row-major, one `LIVE`/`DEAD` byte per cell).
+    /// @param region the window, without the added border
+    virtual void readRegion(const Region &region, vector<char> &out) = 0;
+
+    /// @brief The census of the current generation; the bounding box is in grid coordinates, border included.
+    virtual GenerationStats statistics() = 0;
+
+    /// @brief Calls `visit(row, col)` for every live cell outside the added border, in no particular order.
+    /// The default reads the board in bands of rows, backends that can skip empty areas override it.
+    virtual void forEachLive(const function<void(int, int)> &visit)
+    {
+        const int size = this->size();
+        const int band = 64;
+        vector<char> cells;
+        for (int firstRow = 0; firstRow < size; firstRow += band)
+        {
+            const int rows = min(band, size - firstRow);
+            readRegion(Region{0, firstRow, size, rows}, cells);
+            for (size_t i = 0; i < cells.size(); ++i)
+            {
+                if (cells[i] == Constants::LIVE)
+                    visit(firstRow + static_cast<int>(i / size), static_cast<int>(i % size));
+            }
+        }
+    }
+
+    /// @brief Computes a window `generations` generations after the current one.
+    /// The default advances the whole board; backends that can answer from the light cone of the window may leave the board where it is,
+    /// so the generation of the board is unspecified afterwards.
+    virtual void queryRegion(const Region &region, const int generations, vector<char> &out)
+    {
+        step(generations);
+        readRegion(region, out);
+    }
+
+    /// @brief false on the processes of a distributed backend that do not write the output.
+    virtual bool isRoot() const
+    {
+        return true;
+    }
+
+    /// @brief Backend-specific details printed after a run, empty when there is nothing to report.
+    virtual string summary()
+    {
+        return "";
+    }
+};
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef ENGINE_REGISTRY_H
+#define ENGINE_REGISTRY_H
+
+#include <string>
+#include <map>
+#include <memory>
+#include <functional>
+#include <stdexcept>
+
+#include "./Engine.h"
+#include "./DenseEngine.h"
+#include "./SparseEngine.h"
+#include "../structures/BalanceOptions.h"
+#ifdef HAVE_MPI
+#include "./MpiEngine.h"
+#endif
+
+using namespace std;
+
+/// @brief Looks up a `--<name>=<value>` option of the program, returning `defaultValue` when it is missing.
+using EngineOptions = function<string(const string &name, const string &defaultValue)>;
+
+/// @brief Creates an engine, reading its own options (threads, balancing, ...) through `EngineOptions`.
+using EngineFactory = function<unique_ptr<Engine>(const EngineOptions &options)>;
+
+/// @brief The backends that can be selected with `--engine=<name>`, by name.
+/// The `mpi` backend is only available in programs compiled with `-DHAVE_MPI` (and mpic++).
+inline map<string, EngineFactory> &engineRegistry()
+{
+    static map<string, EngineFactory> registry = {
+        {"dense", [](const EngineOptions &)
+         { return unique_ptr<Engine>(make_unique<DenseEngine>()); }},
+        {"sparse", [](const EngineOptions &)
+         { return unique_ptr<Engine>(make_unique<SparseEngine>()); }},
+#ifdef HAVE_MPI
+        {"mpi", [](const EngineOptions &options)
+         {
+             // `--rebalance-interval=<generations>`, `--imbalance-threshold=<factor>`, `--rebalance-margin=<factor>`,
+             // `--balance-by=rows|cells|time` and `--threads=<per rank>`.
+             BalanceOptions balance;
+             balance.interval = stoi(options("rebalance-interval", to_string(balance.interval)));
+             balance.threshold = stod(options("imbalance-threshold", to_string(balance.threshold)));
+             balance.margin = stod(options("rebalance-margin", to_string(balance.margin)));
+             balance.metric = options("balance-by", balance.metric);
+             if (balance.metric != "rows" && balance.metric != "cells" && balance.metric != "time")
+             {
+                 throw runtime_error("Unknown load metric " + balance.metric + ", use rows, cells or time");
+             }
+             return unique_ptr<Engine>(make_unique<MpiEngine>(stoi(options("threads", "1")), balance));
+         }},
+#endif
+    };
+    return registry;
+}
+
+/// @brief Adds a backend to the registry, replacing any backend with the same name.
+inline void registerEngine(const string &name, EngineFactory factory)
+{
+    engineRegistry()[name] = move(factory);
+}
+
+/// @brief The names of the registered backends, separated by commas.
+inline string engineNames()
+{
+    string names;
+    for (const auto &[name, factory] : engineRegistry())
+    {
+        names += (names.empty() ? "" : ", ") + name;
+    }
+    return names;
+}
+
+/// @brief Creates the backend registered under `name`.
+/// @throws runtime_error when no backend has that name
+inline unique_ptr<Engine> createEngine(const string &name, const EngineOptions &options)
+{
+    const auto it = engineRegistry().find(name);
+    if (it == engineRegistry().end())
+    {
+        throw runtime_error("Unknown engine " + name + ", available engines: " + engineNames());
+    }
+    return it->second(options);
+}
+
+#endif
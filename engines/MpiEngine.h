@@ -0,0 +1,760 @@
+#ifndef MPI_ENGINE_H
+#define MPI_ENGINE_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+#include <mpi.h>
+
+#include "./Engine.h"
+#include "../structures/BoardInput.h"
+#include "../structures/BalanceOptions.h"
+#include "../structures/ThreadTeam.h"
+#include "../constants.h"
+
+using namespace std;
+using namespace Constants;
+
+/// Row slabs of the bordered grid distributed over the ranks of MPI_COMM_WORLD, every rank splitting its slab between a team of threads.
+/// The distribution is global to the process, so only one board can be distributed at a time.
+namespace Mpi
+{
+    inline int SIZE = 0;
+
+    inline MPI_Comm comm;
+    inline int comm_size = 1, comm_rank = 0;
+    // The rank among the ranks running on the same node, and their number, so unbound thread teams do not pin to the same CPUs.
+    inline int local_rank = 0, local_size = 1;
+
+    // Rank `r` owns the global rows [row_bounds[r], row_bounds[r + 1]) of the bordered grid.
+    inline vector<int> row_bounds;
+
+    inline BalanceOptions balance;
+
+    // The number of threads that split the slab of every rank, only the master thread talks to MPI (MPI_THREAD_FUNNELED).
+    inline int num_threads = 1;
+
+    class Game;
+
+    /// @brief Steps the slab of one rank: ghost row exchange, neighbour counting and the border rule.
+    class Kernel
+    {
+    public:
+        Kernel(Game *game);
+
+        void resize();
+
+        void count_neighbors();
+
+        void up(vector<MPI_Request> &requests);
+
+        void down(vector<MPI_Request> &requests);
+
+        void clear_border();
+
+        void set_ghost();
+
+        void update_workspace();
+
+        void next_state();
+
+        vector<double> row_weights() const;
+
+        void reset_compute_time();
+
+        GenerationStats statistics() const;
+
+    private:
+        Game *_game;
+        vector<vector<short>> _neighbor;
+        // Live cells on every local row, ghost rows included; rows whose neighbourhood is empty are skipped.
+        vector<int> _row_live;
+        // First and last live column of every local row, -1 when the row is empty.
+        vector<int> _row_first;
+        vector<int> _row_last;
+        // Births and deaths of every owned row in the last step, births in the two outer columns on each side counted apart
+        // so the border rule can take the cells it clears out of them.
+        vector<int> _row_births;
+        vector<int> _row_deaths;
+        vector<int> _edge_births;
+        // Births and deaths of the slab in the last step.
+        long long _births;
+        long long _deaths;
+        // Rows whose neighbourhood had live cells when the neighbours were counted.
+        vector<char> _active;
+        double _compute_time;
+
+        bool is_active(int row) const;
+
+        void count_row_live(int row);
+    };
+
+    /// @brief The slab owned by one rank and its thread team; moves rows between ranks when the load is uneven.
+    class Game
+    {
+    public:
+        ThreadTeam _team;
+        // Owned rows are 1.._rows, rows 0 and _rows + 1 are the ghost rows received from the neighbouring ranks.
+        vector<vector<short>> _workspace;
+        int _rows;
+
+        Game(const vector<short> &slab, int rows);
+
+        void animate(int no_iter);
+
+        GenerationStats statistics();
+
+        void gatherRegion(const Region &region, vector<char> &out);
+
+        vector<vector<short>> allocate_rows(int rows);
+
+        /// @brief Runs `f(first_row, last_row)` on every thread of the team, each one on its own contiguous range of owned rows.
+        template <typename Function>
+        void parallel_rows(Function f)
+        {
+            _team.run([&](int thread)
+                      { f(1 + static_cast<long long>(_rows) * thread / _team.size(),
+                          1 + static_cast<long long>(_rows) * (thread + 1) / _team.size()); });
+        }
+
+    private:
+        Kernel _kernel;
+        int _generation;
+        // The generation of the last migration (-1 if none) and the imbalance factor it was expected to reach,
+        // reported with the factor measured at the next check.
+        int _migrated_at = -1;
+        double _expected_imbalance = 0;
+
+        void rebalance(int generation);
+
+        void migrate(const vector<int> &new_bounds);
+    };
+
+    inline Kernel::Kernel(Game *game) : _game(game), _births(0), _deaths(0), _compute_time(0)
+    {
+    }
+
+    inline void Kernel::resize()
+    {
+        const vector<vector<short>> &w = _game->_workspace;
+        _neighbor = _game->allocate_rows(w.size() - 2);
+        _row_live.assign(w.size(), 0);
+        _row_first.assign(w.size(), -1);
+        _row_last.assign(w.size(), -1);
+        _row_births.assign(w.size(), 0);
+        _row_deaths.assign(w.size(), 0);
+        _edge_births.assign(w.size(), 0);
+        _active.assign(w.size(), 0);
+        for (int row = 0; row < static_cast<int>(w.size()); row++)
+        {
+            count_row_live(row);
+        }
+    }
+
+    inline void Kernel::count_row_live(int row)
+    {
+        const vector<short> &cells = _game->_workspace[row];
+        _row_live[row] = count(cells.begin(), cells.end(), LIVE);
+        const auto first = find(cells.begin(), cells.end(), LIVE);
+        _row_first[row] = first == cells.end() ? -1 : first - cells.begin();
+        _row_last[row] = first == cells.end() ? -1 : cells.rend() - find(cells.rbegin(), cells.rend(), LIVE) - 1;
+    }
+
+    inline bool Kernel::is_active(int row) const
+    {
+        return _row_live[row - 1] + _row_live[row] + _row_live[row + 1] > 0;
+    }
+
+    inline void Kernel::count_neighbors()
+    {
+        vector<vector<short>> &w = _game->_workspace;
+        vector<vector<short>> &n = _neighbor;
+
+        _game->parallel_rows([&](int first_row, int last_row)
+                             {
+            for (int row = first_row; row < last_row; row++)
+            {
+                _active[row] = is_active(row);
+                if (!_active[row])
+                {
+                    continue;
+                }
+                const short *above = w[row - 1].data();
+                const short *current = w[row].data();
+                const short *below = w[row + 1].data();
+                short *count = n[row].data();
+
+                // Columns outside the grid are dead, so the first and last column only have one side.
+                count[0] = above[0] + above[1] + current[1] + below[0] + below[1];
+                for (int col = 1; col < SIZE - 1; col++)
+                {
+                    count[col] = above[col - 1] + above[col] + above[col + 1] +
+                                 current[col - 1] + current[col + 1] +
+                                 below[col - 1] + below[col] + below[col + 1];
+                }
+                count[SIZE - 1] = above[SIZE - 2] + above[SIZE - 1] + current[SIZE - 2] + below[SIZE - 2] + below[SIZE - 1];
+            } });
+    }
+
+    inline void Kernel::up(vector<MPI_Request> &requests)
+    {
+        vector<vector<short>> &w = _game->_workspace;
+        if (comm_rank != comm_size - 1)
+        {
+            requests.emplace_back();
+            MPI_Isend(w[_game->_rows].data(), SIZE, MPI_SHORT, comm_rank + 1, 0, comm, &requests.back());
+            requests.emplace_back();
+            MPI_Irecv(w[_game->_rows + 1].data(), SIZE, MPI_SHORT, comm_rank + 1, 0, comm, &requests.back());
+        }
+    }
+
+    inline void Kernel::down(vector<MPI_Request> &requests)
+    {
+        vector<vector<short>> &w = _game->_workspace;
+        if (comm_rank != 0)
+        {
+            requests.emplace_back();
+            MPI_Isend(w[1].data(), SIZE, MPI_SHORT, comm_rank - 1, 0, comm, &requests.back());
+            requests.emplace_back();
+            MPI_Irecv(w[0].data(), SIZE, MPI_SHORT, comm_rank - 1, 0, comm, &requests.back());
+        }
+    }
+
+    /// @brief Applies `cleanBoarder` to the distributed grid: if any rank has a live cell on the outermost ring,
+    /// every rank zeroes its part of the two outer rows and columns. Cleared cells born in this step are taken out of the births,
+    /// the others are counted as deaths.
+    inline void Kernel::clear_border()
+    {
+        vector<vector<short>> &w = _game->_workspace;
+        const int first_row = row_bounds[comm_rank];
+        int one_on_border = 0;
+        for (int row = 1; row <= _game->_rows && !one_on_border; row++)
+        {
+            const int global_row = first_row + row - 1;
+            one_on_border = _row_first[row] == 0 || _row_last[row] == SIZE - 1 ||
+                            ((global_row == 0 || global_row == SIZE - 1) && _row_live[row] > 0);
+        }
+        MPI_Allreduce(MPI_IN_PLACE, &one_on_border, 1, MPI_INT, MPI_MAX, comm);
+        if (!one_on_border)
+        {
+            return;
+        }
+
+        const int to_be_cleaned[4] = {0, 1, SIZE - 2, SIZE - 1};
+        for (int row = 1; row <= _game->_rows; row++)
+        {
+            const int global_row = first_row + row - 1;
+            if (find(begin(to_be_cleaned), end(to_be_cleaned), global_row) != end(to_be_cleaned))
+            {
+                _row_deaths[row] += _row_live[row] - _row_births[row];
+                _row_births[row] = 0;
+                fill(w[row].begin(), w[row].end(), DEAD);
+            }
+            else
+            {
+                int cleared = 0;
+                for (const int col : to_be_cleaned)
+                {
+                    cleared += w[row][col] == LIVE;
+                }
+                _row_deaths[row] += cleared - _edge_births[row];
+                _row_births[row] -= _edge_births[row];
+            }
+            for (const int col : to_be_cleaned)
+            {
+                w[row][col] = DEAD;
+            }
+            count_row_live(row);
+        }
+    }
+
+    inline void Kernel::set_ghost()
+    {
+        vector<MPI_Request> requests;
+        requests.reserve(4);
+        up(requests);
+        down(requests);
+        MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+        count_row_live(0);
+        count_row_live(_game->_rows + 1);
+    }
+
+    inline void Kernel::update_workspace()
+    {
+        vector<vector<short>> &w = _game->_workspace;
+        vector<vector<short>> &n = _neighbor;
+
+        // Every thread has finished counting, so rows can be overwritten without affecting the other threads.
+        _game->parallel_rows([&](int first_row, int last_row)
+                             {
+            for (int row = first_row; row < last_row; row++)
+            {
+                _row_births[row] = _row_deaths[row] = _edge_births[row] = 0;
+                if (!_active[row])
+                {
+                    continue;
+                }
+                int live = 0, births = 0, deaths = 0, edge_births = 0, first = -1, last = -1;
+                for (int col = 0; col < SIZE; col++)
+                {
+                    const short previous = w[row][col];
+                    const short cell = (n[row][col] == 3) || (n[row][col] == 2 && previous == LIVE) ? LIVE : DEAD;
+                    w[row][col] = cell;
+                    if (cell != previous)
+                    {
+                        births += cell;
+                        deaths += previous;
+                        edge_births += cell && (col < BORDER_SIZE || col >= SIZE - BORDER_SIZE);
+                    }
+                    if (cell)
+                    {
+                        live++;
+                        first = first < 0 ? col : first;
+                        last = col;
+                    }
+                }
+                _row_live[row] = live;
+                _row_first[row] = first;
+                _row_last[row] = last;
+                _row_births[row] = births;
+                _row_deaths[row] = deaths;
+                _edge_births[row] = edge_births;
+            } });
+    }
+
+    inline void Kernel::next_state()
+    {
+        set_ghost();
+        const double start = MPI_Wtime();
+        count_neighbors();
+        update_workspace();
+        _compute_time += MPI_Wtime() - start;
+        clear_border();
+
+        _births = _deaths = 0;
+        for (int row = 1; row <= _game->_rows; row++)
+        {
+            _births += _row_births[row];
+            _deaths += _row_deaths[row];
+        }
+    }
+
+    /// @brief The cost of every owned row in the current generation, used to cut the new slabs.
+    /// With `rows`, rows skipped by the kernel cost almost nothing and rows with live cells in their neighbourhood cost a full row sweep;
+    /// with `cells`, every row costs the live cells of its neighbourhood (plus one, so empty rows are not free).
+    inline vector<double> Kernel::row_weights() const
+    {
+        vector<double> weights(_game->_rows);
+        for (int row = 1; row <= _game->_rows; row++)
+        {
+            if (balance.metric == "cells")
+                weights[row - 1] = 1 + _row_live[row - 1] + _row_live[row] + _row_live[row + 1];
+            else
+                weights[row - 1] = is_active(row) ? SIZE : 1;
+        }
+        if (balance.metric == "time")
+        {
+            double total = 0;
+            for (const double weight : weights)
+            {
+                total += weight;
+            }
+            for (double &weight : weights)
+            {
+                weight *= _compute_time / total;
+            }
+        }
+        return weights;
+    }
+
+    inline void Kernel::reset_compute_time()
+    {
+        _compute_time = 0;
+    }
+
+    /// @brief The census of the owned rows, read from the per-row counters kept by the step.
+    /// @return the population, births, deaths and bounding box of the slab, rows in global coordinates
+    inline GenerationStats Kernel::statistics() const
+    {
+        GenerationStats stats;
+        stats.births = _births;
+        stats.deaths = _deaths;
+        for (int row = 1; row <= _game->_rows; row++)
+        {
+            if (_row_live[row] == 0)
+            {
+                continue;
+            }
+            stats.population += _row_live[row];
+            stats.includeRow(row_bounds[comm_rank] + row - 1, _row_first[row], _row_last[row]);
+        }
+        return stats;
+    }
+
+    /// @param slab the owned rows of the rank, one after the other
+    /// @param rows the number of owned rows
+    inline Game::Game(const vector<short> &slab, int rows) : _team(num_threads, local_rank, local_size), _rows(rows), _kernel(this), _generation(0)
+    {
+        _workspace = allocate_rows(rows);
+        parallel_rows([&](int first_row, int last_row)
+                      {
+            for (int row = first_row; row < last_row; row++)
+            {
+                copy_n(slab.begin() + static_cast<size_t>(row - 1) * SIZE, SIZE, _workspace[row].begin());
+            } });
+        _kernel.resize();
+    }
+
+    /// @brief Allocates a slab of `rows` owned rows plus the two ghost rows. Every owned row is allocated and zeroed
+    /// by the thread that will compute it, so with first-touch placement its memory sits on that thread's NUMA node.
+    /// @param rows the number of owned rows
+    /// @return the zeroed rows
+    inline vector<vector<short>> Game::allocate_rows(int rows)
+    {
+        vector<vector<short>> workspace(rows + 2);
+        workspace[0].assign(SIZE, DEAD);
+        workspace[rows + 1].assign(SIZE, DEAD);
+        _team.run([&](int thread)
+                  {
+            const int first_row = 1 + static_cast<long long>(rows) * thread / _team.size();
+            const int last_row = 1 + static_cast<long long>(rows) * (thread + 1) / _team.size();
+            for (int row = first_row; row < last_row; row++)
+            {
+                workspace[row].assign(SIZE, DEAD);
+            } });
+        return workspace;
+    }
+
+    inline void Game::animate(int no_iter)
+    {
+        for (int i = 0; i < no_iter; i++)
+        {
+            _kernel.next_state();
+            _generation++;
+            if (balance.interval > 0 && comm_size > 1 && _generation % balance.interval == 0)
+            {
+                rebalance(_generation);
+            }
+        }
+    }
+
+    /// @brief Measures the load of every rank and, when the imbalance factor (maximum load / mean load) exceeds the threshold,
+    /// cuts new row slabs of equal weight and migrates the rows that changed owner.
+    /// The factor of the new slabs is only an estimate (from the weights measured before the migration), so rows are moved only when it is
+    /// lower by more than the margin, and the factor actually measured at the next check is reported next to it.
+    /// @param generation the current generation, used in the report
+    inline void Game::rebalance(int generation)
+    {
+        const vector<double> weights = _kernel.row_weights();
+        double load = 0;
+        for (const double weight : weights)
+        {
+            load += weight;
+        }
+        _kernel.reset_compute_time();
+
+        vector<double> loads(comm_size);
+        MPI_Allgather(&load, 1, MPI_DOUBLE, loads.data(), 1, MPI_DOUBLE, comm);
+        double total = 0, max_load = 0;
+        for (const double rank_load : loads)
+        {
+            total += rank_load;
+            max_load = max(max_load, rank_load);
+        }
+        if (total <= 0)
+        {
+            return;
+        }
+        const double imbalance_before = max_load * comm_size / total;
+        if (_migrated_at >= 0 && comm_rank == 0)
+        {
+            cout << "Generation " << generation << ": imbalance factor " << imbalance_before << " measured since the migration at generation "
+                 << _migrated_at << " (estimated " << _expected_imbalance << ")\n";
+        }
+        _migrated_at = -1;
+        if (imbalance_before <= balance.threshold)
+        {
+            return;
+        }
+
+        vector<int> counts(comm_size), displacements(comm_size);
+        for (int r = 0; r < comm_size; r++)
+        {
+            counts[r] = row_bounds[r + 1] - row_bounds[r];
+            displacements[r] = row_bounds[r];
+        }
+        vector<double> all_weights(SIZE);
+        MPI_Allgatherv(weights.data(), weights.size(), MPI_DOUBLE, all_weights.data(), counts.data(), displacements.data(), MPI_DOUBLE, comm);
+
+        // Every rank runs the same greedy cut on the same weights, so the new bounds agree without another exchange.
+        vector<int> new_bounds(comm_size + 1, SIZE);
+        new_bounds[0] = 0;
+        double prefix = 0, max_after = 0, slab = 0;
+        int part = 1;
+        for (int row = 0; row < SIZE && part < comm_size; row++)
+        {
+            prefix += all_weights[row];
+            slab += all_weights[row];
+            const bool enough_weight = prefix >= total * part / comm_size;
+            const bool must_cut = SIZE - (row + 1) == comm_size - part;
+            if (enough_weight || must_cut)
+            {
+                new_bounds[part++] = row + 1;
+                max_after = max(max_after, slab);
+                slab = 0;
+            }
+        }
+        max_after = max(max_after, total - prefix + slab);
+        const double imbalance_after = max_after * comm_size / total;
+
+        const bool worth_it = new_bounds != row_bounds && imbalance_after < imbalance_before - balance.margin;
+        if (comm_rank == 0)
+        {
+            cout << "Generation " << generation << ": imbalance factor " << imbalance_before << ", estimated " << imbalance_after
+                 << (worth_it ? " after migrating rows" : " with new slabs, not worth migrating") << "\n";
+        }
+        if (worth_it)
+        {
+            migrate(new_bounds);
+            _migrated_at = generation;
+            _expected_imbalance = imbalance_after;
+        }
+    }
+
+    /// @brief Moves rows between ranks so that every rank owns its slab in `new_bounds`.
+    /// Slabs are contiguous, so rows usually only travel to the neighbouring ranks.
+    /// @param new_bounds the new first row of every rank, followed by SIZE
+    inline void Game::migrate(const vector<int> &new_bounds)
+    {
+        const int old_first = row_bounds[comm_rank], old_last = row_bounds[comm_rank + 1];
+        const int new_first = new_bounds[comm_rank], new_last = new_bounds[comm_rank + 1];
+
+        vector<vector<short>> send_buffers(comm_size), recv_buffers(comm_size);
+        vector<MPI_Request> requests;
+        for (int r = 0; r < comm_size; r++)
+        {
+            if (r == comm_rank)
+            {
+                continue;
+            }
+            const int send_first = max(old_first, new_bounds[r]), send_last = min(old_last, new_bounds[r + 1]);
+            if (send_first < send_last)
+            {
+                vector<short> &buffer = send_buffers[r];
+                buffer.reserve(static_cast<size_t>(send_last - send_first) * SIZE);
+                for (int row = send_first; row < send_last; row++)
+                {
+                    const vector<short> &cells = _workspace[row - old_first + 1];
+                    buffer.insert(buffer.end(), cells.begin(), cells.end());
+                }
+                requests.emplace_back();
+                MPI_Isend(buffer.data(), buffer.size(), MPI_SHORT, r, 1, comm, &requests.back());
+            }
+            const int recv_first = max(new_first, row_bounds[r]), recv_last = min(new_last, row_bounds[r + 1]);
+            if (recv_first < recv_last)
+            {
+                recv_buffers[r].resize(static_cast<size_t>(recv_last - recv_first) * SIZE);
+                requests.emplace_back();
+                MPI_Irecv(recv_buffers[r].data(), recv_buffers[r].size(), MPI_SHORT, r, 1, comm, &requests.back());
+            }
+        }
+
+        vector<vector<short>> workspace = allocate_rows(new_last - new_first);
+        for (int row = max(old_first, new_first); row < min(old_last, new_last); row++)
+        {
+            workspace[row - new_first + 1] = _workspace[row - old_first + 1];
+        }
+        MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+        for (int r = 0; r < comm_size; r++)
+        {
+            const int recv_first = max(new_first, row_bounds[r]);
+            for (size_t offset = 0; offset < recv_buffers[r].size(); offset += SIZE)
+            {
+                const int row = recv_first + offset / SIZE;
+                copy_n(recv_buffers[r].begin() + offset, SIZE, workspace[row - new_first + 1].begin());
+            }
+        }
+
+        row_bounds = new_bounds;
+        _workspace = move(workspace);
+        _rows = new_last - new_first;
+        _kernel.resize();
+    }
+
+    /// @brief Sums the census of every slab.
+    /// @return the census of the whole grid, on every rank
+    inline GenerationStats Game::statistics()
+    {
+        GenerationStats stats = _kernel.statistics();
+        long long sums[3] = {stats.population, stats.births, stats.deaths};
+        int bounds[4] = {stats.minRow, stats.minCol, -stats.maxRow, -stats.maxCol};
+        MPI_Allreduce(MPI_IN_PLACE, sums, 3, MPI_LONG_LONG, MPI_SUM, comm);
+        MPI_Allreduce(MPI_IN_PLACE, bounds, 4, MPI_INT, MPI_MIN, comm);
+        stats.generation = _generation;
+        stats.population = sums[0];
+        stats.births = sums[1];
+        stats.deaths = sums[2];
+        stats.minRow = bounds[0];
+        stats.minCol = bounds[1];
+        stats.maxRow = -bounds[2];
+        stats.maxCol = -bounds[3];
+        return stats;
+    }
+
+    /// @brief Collects a window of the grid on rank 0: every rank sends only the part of the window that lies in its slab.
+    /// @param region the window, without the added border
+    /// @param out the window on rank 0, dead cells on the other ranks
+    inline void Game::gatherRegion(const Region &region, vector<char> &out)
+    {
+        const int window_first = region.y0 + BORDER_SIZE, window_last = window_first + region.height;
+        const int first_col = region.x0 + BORDER_SIZE;
+        vector<int> counts(comm_size), displacements(comm_size);
+        for (int r = 0; r < comm_size; r++)
+        {
+            const int first = max(window_first, row_bounds[r]), last = min(window_last, row_bounds[r + 1]);
+            counts[r] = max(0, last - first) * region.width;
+            displacements[r] = max(0, first - window_first) * region.width;
+        }
+
+        vector<char> local;
+        local.reserve(counts[comm_rank]);
+        for (int row = max(window_first, row_bounds[comm_rank]); row < min(window_last, row_bounds[comm_rank + 1]); row++)
+        {
+            const vector<short> &cells = _workspace[row - row_bounds[comm_rank] + 1];
+            local.insert(local.end(), cells.begin() + first_col, cells.begin() + first_col + region.width);
+        }
+        out.assign(static_cast<size_t>(region.height) * region.width, DEAD);
+        MPI_Gatherv(local.data(), local.size(), MPI_CHAR, out.data(), counts.data(), displacements.data(), MPI_CHAR, 0, comm);
+    }
+
+    /// @brief Splits `rows` rows into `parts` contiguous slabs of (almost) equal height.
+    /// @return the first row of every slab, followed by `rows`
+    inline vector<int> evenBounds(const int rows, const int parts)
+    {
+        vector<int> bounds(parts + 1);
+        for (int r = 0; r <= parts; r++)
+        {
+            bounds[r] = static_cast<long long>(rows) * r / parts;
+        }
+        return bounds;
+    }
+}
+
+/// @brief The engine of the MPI program: the grid is cut in row slabs, one per rank, exchanged through ghost rows,
+/// with optional thread teams inside every rank and dynamic load balancing (see `BalanceOptions`).
+/// MPI has to be initialised (with at least MPI_THREAD_FUNNELED for more than one thread) before the engine is created.
+class MpiEngine : public Engine
+{
+public:
+    MpiEngine(const int threads, const BalanceOptions &balance)
+    {
+        int initialized;
+        MPI_Initialized(&initialized);
+        if (!initialized)
+        {
+            throw runtime_error("The mpi engine needs MPI, run the program with mpirun");
+        }
+        Mpi::comm = MPI_COMM_WORLD;
+        MPI_Comm_size(Mpi::comm, &Mpi::comm_size);
+        MPI_Comm_rank(Mpi::comm, &Mpi::comm_rank);
+        MPI_Comm node;
+        MPI_Comm_split_type(Mpi::comm, MPI_COMM_TYPE_SHARED, Mpi::comm_rank, MPI_INFO_NULL, &node);
+        MPI_Comm_rank(node, &Mpi::local_rank);
+        MPI_Comm_size(node, &Mpi::local_size);
+        MPI_Comm_free(&node);
+        Mpi::balance = balance;
+        Mpi::num_threads = max(1, threads);
+        int provided;
+        MPI_Query_thread(&provided);
+        if (Mpi::num_threads > 1 && provided < MPI_THREAD_FUNNELED)
+        {
+            if (Mpi::comm_rank == 0)
+            {
+                cout << "The MPI library does not support MPI_THREAD_FUNNELED, running with one thread per rank\n";
+            }
+            Mpi::num_threads = 1;
+        }
+    }
+
+    /// @brief Reads the input on rank 0 and scatters the initial slabs, every rank gets the same number of rows (plus or minus one).
+    bool load(const string &inputData) override
+    {
+        using namespace Mpi;
+        int denseInput = 1;
+        vector<short> flat;
+        if (comm_rank == 0)
+        {
+            bool dense;
+            readBoard(
+                inputData, dense,
+                [&](const int size)
+                {
+                    SIZE = size + 2 * BORDER_SIZE;
+                    flat.assign(static_cast<size_t>(SIZE) * SIZE, DEAD);
+                },
+                [&](const int row, const int col)
+                { flat[static_cast<size_t>(row + BORDER_SIZE) * SIZE + col + BORDER_SIZE] = LIVE; });
+            denseInput = dense;
+        }
+        MPI_Bcast(&SIZE, 1, MPI_INT, 0, comm);
+        MPI_Bcast(&denseInput, 1, MPI_INT, 0, comm);
+        if (SIZE < comm_size)
+        {
+            throw runtime_error("The grid has fewer rows than there are ranks");
+        }
+
+        row_bounds = evenBounds(SIZE, comm_size);
+        vector<int> counts(comm_size), displacements(comm_size);
+        for (int r = 0; r < comm_size; r++)
+        {
+            counts[r] = (row_bounds[r + 1] - row_bounds[r]) * SIZE;
+            displacements[r] = row_bounds[r] * SIZE;
+        }
+        const int rows = row_bounds[comm_rank + 1] - row_bounds[comm_rank];
+        vector<short> slab(static_cast<size_t>(rows) * SIZE);
+        MPI_Scatterv(flat.data(), counts.data(), displacements.data(), MPI_SHORT, slab.data(), slab.size(), MPI_SHORT, 0, comm);
+
+        _game.reset();
+        _game = make_unique<Mpi::Game>(slab, rows);
+        return denseInput;
+    }
+
+    int size() const override
+    {
+        return max(0, Mpi::SIZE - 2 * BORDER_SIZE);
+    }
+
+    void step(const int generations) override
+    {
+        _game->animate(generations);
+    }
+
+    void readRegion(const Region &region, vector<char> &out) override
+    {
+        _game->gatherRegion(region, out);
+    }
+
+    GenerationStats statistics() override
+    {
+        return _game->statistics();
+    }
+
+    bool isRoot() const override
+    {
+        return Mpi::comm_rank == 0;
+    }
+
+    string summary() override
+    {
+        return "Ranks = " + to_string(Mpi::comm_size) + ", threads per rank = " + to_string(Mpi::num_threads);
+    }
+
+private:
+    unique_ptr<Mpi::Game> _game;
+};
+
+#endif
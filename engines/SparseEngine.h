@@ -0,0 +1,66 @@
+#ifndef SPARSE_ENGINE_H
+#define SPARSE_ENGINE_H
+
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "./Engine.h"
+#include "../structures/SparseBoard.h"
+#include "../constants.h"
+
+using namespace std;
+
+/// @brief The engine of the sparse program: a `SparseBoard` of bit-packed chunks, whose memory scales with the live area.
+class SparseEngine : public Engine
+{
+public:
+    bool load(const string &inputData) override
+    {
+        bool denseInput;
+        _board = loadSparseBoard(inputData, denseInput);
+        return denseInput;
+    }
+
+    int size() const override
+    {
+        return max(0, _board.size() - 2 * Constants::BORDER_SIZE);
+    }
+
+    void step(const int generations) override
+    {
+        _board.step(generations);
+    }
+
+    void readRegion(const Region &region, vector<char> &out) override
+    {
+        _board.readRegion(region.y0 + Constants::BORDER_SIZE, region.x0 + Constants::BORDER_SIZE, region.height, region.width, out);
+    }
+
+    GenerationStats statistics() override
+    {
+        return _board.statistics();
+    }
+
+    /// @brief Visits only the resident chunks.
+    void forEachLive(const function<void(int, int)> &visit) override
+    {
+        const int size = this->size();
+        _board.forEachLive([&](const int row, const int col)
+                           {
+            const int innerRow = row - Constants::BORDER_SIZE;
+            const int innerCol = col - Constants::BORDER_SIZE;
+            if (static_cast<unsigned>(innerRow) < static_cast<unsigned>(size) && static_cast<unsigned>(innerCol) < static_cast<unsigned>(size))
+                visit(innerRow, innerCol); });
+    }
+
+    string summary() override
+    {
+        return "Resident chunks = " + to_string(_board.chunkCount()) + " (pool of " + to_string(_board.pooledChunkCount()) + ")";
+    }
+
+private:
+    SparseBoard _board;
+};
+
+#endif
@@ -0,0 +1,134 @@
+// The header files for input-output operations, containers, threads and timing have been included.
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+
+#include "../structures/Protocol.h"
+#include "../utils.h"
+
+using namespace std;
+using namespace chrono;
+
+// Snapshots of bigger boards are skipped, a bit-packed 1M x 1M board is 125 GB.
+const uint32_t MAX_SNAPSHOT_SIDE = 8192;
+
+/// @brief Latencies of one kind of request, in seconds.
+struct Latencies
+{
+	string name;
+	vector<double> samples;
+
+	void print() const
+	{
+		if (samples.empty())
+			return;
+		vector<double> sorted = samples;
+		sort(sorted.begin(), sorted.end());
+		double total = 0;
+		for (const double sample : sorted)
+		{
+			total += sample;
+		}
+		const auto percentile = [&](const double p)
+		{ return sorted[min(sorted.size() - 1, static_cast<size_t>(p * sorted.size()))] * 1e6; };
+		cout << name << ": " << sorted.size() << " requests, mean " << total / sorted.size() * 1e6 << " us, p50 " << percentile(0.5)
+			 << " us, p90 " << percentile(0.9) << " us, p99 " << percentile(0.99) << " us, max " << sorted.back() * 1e6 << " us\n";
+	}
+};
+
+/// @brief Measures the time of one request.
+template <typename Request>
+void measure(Latencies &latencies, Request request)
+{
+	const auto start = high_resolution_clock::now();
+	request();
+	latencies.samples.push_back(duration_cast<nanoseconds>(high_resolution_clock::now() - start).count() * 1e-9);
+}
+
+/// @brief Latency benchmark of the Game of Life server. Every client loads its own copy of `inputData/<input>.txt` once,
+/// then alternates step, query and (on boards up to MAX_SNAPSHOT_SIDE) snapshot requests on it; the load latency is the cost every request used to pay.
+/// Options: `--requests=<per client>`, `--generations=<per step>`, `--clients=<connections>`, `--window=<query side>`, `--socket=<path>`.
+int main(int argc, char **argv)
+{
+	if (argc < 2)
+	{
+		cout << "Usage: benchmark <input> [--requests=100] [--generations=100] [--clients=4] [--window=64] [--socket=<path>]\n";
+		return 1;
+	}
+	const string inputData = readFile(argv[1]);
+	const int requests = stoi(getOption(argc, argv, "requests", "100", 2));
+	const uint64_t generations = stoull(getOption(argc, argv, "generations", "100", 2));
+	const int clients = max(1, stoi(getOption(argc, argv, "clients", "4", 2)));
+	const int window = max(1, stoi(getOption(argc, argv, "window", "64", 2)));
+	const string socketPath = getOption(argc, argv, "socket", Protocol::DEFAULT_SOCKET, 2);
+
+	vector<Latencies> loads(clients, Latencies{"load", {}}), steps(clients, Latencies{"step", {}}), queries(clients, Latencies{"query", {}}), snapshots(clients, Latencies{"snapshot", {}});
+	vector<string> errors(clients);
+	const auto start = high_resolution_clock::now();
+	vector<thread> threads;
+	for (int client = 0; client < clients; ++client)
+	{
+		threads.emplace_back([&, client]
+							 {
+			try
+			{
+				const int fd = Protocol::connectToServer(socketPath);
+				vector<uint8_t> reply;
+				uint32_t board = 0, size = 0;
+				measure(loads[client], [&]
+						{
+					board = Protocol::call(fd, Protocol::LOAD, 0, inputData.data(), inputData.size(), reply).board;
+					memcpy(&size, reply.data(), sizeof(size)); });
+				const int side = min<int>(window, size);
+				const Protocol::QueryRequest query = {0, 0, side, side};
+				for (int i = 0; i < requests; ++i)
+				{
+					measure(steps[client], [&]
+							{ Protocol::call(fd, Protocol::STEP, board, &generations, sizeof(generations), reply); });
+					measure(queries[client], [&]
+							{ Protocol::call(fd, Protocol::QUERY, board, &query, sizeof(query), reply); });
+					if (i % 10 == 0 && size <= MAX_SNAPSHOT_SIDE)
+					{
+						measure(snapshots[client], [&]
+								{ Protocol::call(fd, Protocol::SNAPSHOT, board, nullptr, 0, reply); });
+					}
+				}
+				Protocol::call(fd, Protocol::FREE, board, nullptr, 0, reply);
+				close(fd);
+			}
+			catch (const exception &error)
+			{
+				errors[client] = error.what();
+			} });
+	}
+	for (thread &worker : threads)
+	{
+		worker.join();
+	}
+	const double elapsed = duration_cast<nanoseconds>(high_resolution_clock::now() - start).count() * 1e-9;
+
+	for (const string &error : errors)
+	{
+		if (!error.empty())
+		{
+			cout << error << "\n";
+			return 1;
+		}
+	}
+	for (vector<Latencies> *kind : {&loads, &steps, &queries, &snapshots})
+	{
+		Latencies merged{kind->front().name, {}};
+		for (const Latencies &latencies : *kind)
+		{
+			merged.samples.insert(merged.samples.end(), latencies.samples.begin(), latencies.samples.end());
+		}
+		merged.print();
+	}
+	cout << clients << " clients, " << generations << " generations per step, " << elapsed << " seconds in total\n";
+	return 0;
+}
@@ -0,0 +1,93 @@
+// The header files for input-output operations, string operations and containers have been included.
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include "../structures/Protocol.h"
+#include "../utils.h"
+
+using namespace std;
+
+/// @brief Prints a bit-packed board or window, one row of `0`/`1` per line.
+void printBits(const uint8_t *bits, const int width, const int height)
+{
+	for (int row = 0; row < height; ++row)
+	{
+		for (int col = 0; col < width; ++col)
+		{
+			cout << Protocol::cellAt(bits, width, row, col);
+		}
+		cout << "\n";
+	}
+}
+
+/// @brief Small command-line client of the Game of Life server:
+///	load <input>						loads `inputData/<input>.txt` and prints the id of the new board
+///	step <board> <generations>			advances the board and prints its generation and population
+///	snapshot <board>					prints the whole board
+///	query <board> <x0> <y0> <w> <h>		prints a window of the board
+///	free <board>						removes the board from the server
+/// The socket is chosen with `--socket=<path>`.
+int main(int argc, char **argv)
+{
+	if (argc < 2)
+	{
+		cout << "Usage: client load|step|snapshot|query|free ... [--socket=<path>]\n";
+		return 1;
+	}
+	const string command = argv[1];
+	const string socketPath = getOption(argc, argv, "socket", Protocol::DEFAULT_SOCKET, 2);
+	vector<uint8_t> reply;
+	try
+	{
+		const int fd = Protocol::connectToServer(socketPath);
+		if (command == "load" && argc >= 3)
+		{
+			const string inputData = readFile(argv[2]);
+			const Protocol::ReplyHeader header = Protocol::call(fd, Protocol::LOAD, 0, inputData.data(), inputData.size(), reply);
+			uint32_t size;
+			memcpy(&size, reply.data(), sizeof(size));
+			cout << "board " << header.board << " (" << size << "x" << size << ")\n";
+		}
+		else if (command == "step" && argc >= 4)
+		{
+			const uint64_t generations = stoull(argv[3]);
+			Protocol::call(fd, Protocol::STEP, stoul(argv[2]), &generations, sizeof(generations), reply);
+			Protocol::StepReply step;
+			memcpy(&step, reply.data(), sizeof(step));
+			cout << "generation " << step.generation << ", population " << step.population << "\n";
+		}
+		else if (command == "snapshot" && argc >= 3)
+		{
+			Protocol::call(fd, Protocol::SNAPSHOT, stoul(argv[2]), nullptr, 0, reply);
+			uint32_t size;
+			memcpy(&size, reply.data(), sizeof(size));
+			printBits(reply.data() + sizeof(size), size, size);
+		}
+		else if (command == "query" && argc >= 7)
+		{
+			const Protocol::QueryRequest query = {stoi(argv[3]), stoi(argv[4]), stoi(argv[5]), stoi(argv[6])};
+			Protocol::call(fd, Protocol::QUERY, stoul(argv[2]), &query, sizeof(query), reply);
+			printBits(reply.data(), query.width, query.height);
+		}
+		else if (command == "free" && argc >= 3)
+		{
+			Protocol::call(fd, Protocol::FREE, stoul(argv[2]), nullptr, 0, reply);
+		}
+		else
+		{
+			cout << "Unknown command or missing arguments: " << command << "\n";
+			close(fd);
+			return 1;
+		}
+		close(fd);
+	}
+	catch (const exception &error)
+	{
+		cout << error.what() << "\n";
+		return 1;
+	}
+	return 0;
+}
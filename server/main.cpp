@@ -0,0 +1,440 @@
+// The header files for input-output operations, containers, threads and Unix domain sockets have been included.
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <chrono>
+#include <climits>
+#include <cerrno>
+#include <csignal>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "../engines/EngineRegistry.h"
+#include "../structures/Region.h"
+#include "../structures/BoundedQueue.h"
+#include "../structures/Protocol.h"
+#include "../utils.h"
+#include "../constants.h"
+
+using namespace std;
+using namespace Constants;
+
+// Requests larger than this are refused, so a broken client cannot make the server allocate without limit.
+const uint64_t MAX_PAYLOAD = uint64_t(1) << 31;
+// A client that does not read its reply for this long is disconnected, so it cannot keep a worker (and the lock of its board) forever.
+const int SEND_TIMEOUT_MS = 10000;
+
+/// @brief A board kept in memory between requests. Requests on the same board are serialised by its mutex,
+/// requests on different boards run in parallel.
+struct Session
+{
+    mutex lock;
+    unique_ptr<Engine> engine;
+    uint64_t generation = 0;
+};
+
+/// @brief The boards currently resident in the server, by id.
+class BoardStore
+{
+public:
+    uint32_t add(unique_ptr<Engine> engine)
+    {
+        shared_ptr<Session> session = make_shared<Session>();
+        session->engine = move(engine);
+        lock_guard<mutex> lock(_mutex);
+        const uint32_t id = _nextId++;
+        _sessions[id] = session;
+        return id;
+    }
+
+    shared_ptr<Session> find(const uint32_t id)
+    {
+        lock_guard<mutex> lock(_mutex);
+        const auto it = _sessions.find(id);
+        return it == _sessions.end() ? nullptr : it->second;
+    }
+
+    bool erase(const uint32_t id)
+    {
+        lock_guard<mutex> lock(_mutex);
+        return _sessions.erase(id) > 0;
+    }
+
+private:
+    mutex _mutex;
+    unordered_map<uint32_t, shared_ptr<Session>> _sessions;
+    uint32_t _nextId = 1;
+};
+
+BoardStore boards;
+
+// The engine of the boards loaded from now on, chosen with `--engine`.
+string engineName = "sparse";
+EngineOptions engineOptions;
+
+/// @brief Sends a reply header followed by its payload.
+bool sendReply(const int fd, const uint32_t board, const void *payload, const size_t size)
+{
+    const Protocol::ReplyHeader header = {Protocol::OK, board, size};
+    return Protocol::sendAll(fd, &header, sizeof(header), SEND_TIMEOUT_MS) && Protocol::sendAll(fd, payload, size, SEND_TIMEOUT_MS);
+}
+
+/// @param timeoutMs how long to wait for a client that does not read, the dispatcher does not wait at all
+bool sendError(const int fd, const string &message, const int timeoutMs = SEND_TIMEOUT_MS)
+{
+    const Protocol::ReplyHeader header = {Protocol::ERROR, 0, message.size()};
+    return Protocol::sendAll(fd, &header, sizeof(header), timeoutMs) && Protocol::sendAll(fd, message.data(), message.size(), timeoutMs);
+}
+
+/// @brief Streams a window of the board, bit-packed, one band of chunk rows at a time:
+/// only one band is ever materialised, whatever the size of the window.
+/// @param fd the client socket
+/// @param engine the engine holding the board
+/// @param region the window, without the border
+/// @param prefix bytes sent right after the reply header, before the window
+/// @return false if the client went away
+bool streamRegion(const int fd, const uint32_t id, Engine &engine, const Region &region, const string &prefix)
+{
+    const size_t bytesPerRow = Protocol::rowBytes(region.width);
+    const Protocol::ReplyHeader header = {Protocol::OK, id, prefix.size() + bytesPerRow * region.height};
+    if (!Protocol::sendAll(fd, &header, sizeof(header), SEND_TIMEOUT_MS) || !Protocol::sendAll(fd, prefix.data(), prefix.size(), SEND_TIMEOUT_MS))
+        return false;
+
+    vector<char> cells;
+    vector<uint8_t> band;
+    for (int firstRow = 0; firstRow < region.height; firstRow += Chunk::SIDE)
+    {
+        const int rows = min(Chunk::SIDE, region.height - firstRow);
+        engine.readRegion(Region{region.x0, region.y0 + firstRow, region.width, rows}, cells);
+        band.assign(bytesPerRow * rows, 0);
+        for (int row = 0; row < rows; ++row)
+        {
+            const char *source = &cells[static_cast<size_t>(row) * region.width];
+            uint8_t *target = &band[row * bytesPerRow];
+            for (int col = 0; col < region.width; ++col)
+            {
+                target[col / 8] |= static_cast<uint8_t>(source[col] == LIVE) << (col % 8);
+            }
+        }
+        if (!Protocol::sendAll(fd, band.data(), band.size(), SEND_TIMEOUT_MS))
+            return false;
+    }
+    return true;
+}
+
+/// @brief Executes one request.
+/// @return false if the connection has to be closed
+bool handleRequest(const int fd, const Protocol::RequestHeader &header, const vector<uint8_t> &payload)
+{
+    if (header.type == Protocol::LOAD)
+    {
+        unique_ptr<Engine> engine = createEngine(engineName, engineOptions);
+        engine->load(string(payload.begin(), payload.end()));
+        const uint32_t size = engine->size();
+        const uint32_t id = boards.add(move(engine));
+        return sendReply(fd, id, &size, sizeof(size));
+    }
+
+    const shared_ptr<Session> session = boards.find(header.board);
+    if (session == nullptr)
+    {
+        return sendError(fd, "Unknown board " + to_string(header.board));
+    }
+    lock_guard<mutex> lock(session->lock);
+    const int size = session->engine->size();
+
+    switch (header.type)
+    {
+    case Protocol::STEP:
+    {
+        uint64_t generations;
+        if (payload.size() != sizeof(generations))
+            return sendError(fd, "STEP expects the number of generations");
+        memcpy(&generations, payload.data(), sizeof(generations));
+        if (generations > static_cast<uint64_t>(INT_MAX))
+            return sendError(fd, "STEP accepts at most " + to_string(INT_MAX) + " generations");
+        session->engine->step(static_cast<int>(generations));
+        session->generation += generations;
+        const Protocol::StepReply reply = {session->generation, static_cast<uint64_t>(session->engine->statistics().population)};
+        return sendReply(fd, header.board, &reply, sizeof(reply));
+    }
+    case Protocol::SNAPSHOT:
+    {
+        const uint32_t side = size;
+        return streamRegion(fd, header.board, *session->engine, Region{0, 0, size, size}, string(reinterpret_cast<const char *>(&side), sizeof(side)));
+    }
+    case Protocol::QUERY:
+    {
+        Protocol::QueryRequest query;
+        if (payload.size() != sizeof(query))
+            return sendError(fd, "QUERY expects x0, y0, width and height");
+        memcpy(&query, payload.data(), sizeof(query));
+        const Region region{query.x0, query.y0, query.width, query.height};
+        // Compared as `width > size - x0` so that huge widths cannot overflow the sum.
+        if (region.empty() || region.x0 < 0 || region.y0 < 0 || region.x0 >= size || region.y0 >= size ||
+            region.width > size - region.x0 || region.height > size - region.y0)
+            return sendError(fd, "The query region is outside of the board");
+        return streamRegion(fd, header.board, *session->engine, region, "");
+    }
+    case Protocol::FREE:
+        boards.erase(header.board);
+        return sendReply(fd, header.board, nullptr, 0);
+    default:
+        return sendError(fd, "Unknown request type " + to_string(header.type));
+    }
+}
+
+// Connections are non-blocking and owned by the dispatcher (the main thread), which watches them with `poll` and receives their requests
+// as the bytes arrive. Only complete requests are handed to the workers, and a worker gives the connection back once it has replied,
+// so neither idle clients nor clients that send part of a request hold a worker.
+mutex returnedMutex;
+vector<int> returnedClients;
+// Written to by the workers when they give a connection back and by the signal handler, to wake up the dispatcher.
+int wakePipe[2] = {-1, -1};
+volatile sig_atomic_t stopping = 0;
+
+/// @brief A request being received by the dispatcher.
+struct Connection
+{
+    Protocol::RequestHeader header;
+    // Bytes received so far, the header first and then the payload.
+    size_t received = 0;
+    vector<uint8_t> payload;
+};
+
+/// @brief A complete request, executed by a worker.
+struct Request
+{
+    int fd;
+    Protocol::RequestHeader header;
+    vector<uint8_t> payload;
+};
+
+enum class Reception
+{
+    PENDING,
+    COMPLETE,
+    CLOSED
+};
+
+/// @brief Wakes up the dispatcher. The pipe does not block, a full pipe already has a pending wake-up.
+void wakeDispatcher()
+{
+    const char byte = 0;
+    [[maybe_unused]] const ssize_t written = write(wakePipe[1], &byte, 1);
+}
+
+/// @brief SIGINT and SIGTERM stop the server: the requests already dispatched are completed, then the socket is removed.
+void requestStop(int)
+{
+    stopping = 1;
+    wakeDispatcher();
+}
+
+/// @brief Reads what a client has sent so far, without blocking.
+/// @return COMPLETE once the header and the whole payload have arrived, CLOSED if the connection has to be closed
+Reception receiveRequest(const int fd, Connection &connection)
+{
+    while (true)
+    {
+        char *target;
+        size_t missing;
+        if (connection.received < sizeof(connection.header))
+        {
+            target = reinterpret_cast<char *>(&connection.header) + connection.received;
+            missing = sizeof(connection.header) - connection.received;
+        }
+        else
+        {
+            const size_t payloadReceived = connection.received - sizeof(connection.header);
+            if (payloadReceived == connection.payload.size())
+                return Reception::COMPLETE;
+            target = reinterpret_cast<char *>(connection.payload.data()) + payloadReceived;
+            missing = connection.payload.size() - payloadReceived;
+        }
+
+        const ssize_t received = recv(fd, target, missing, 0);
+        if (received == 0)
+            return Reception::CLOSED;
+        if (received < 0)
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR ? Reception::PENDING : Reception::CLOSED;
+        connection.received += received;
+        if (connection.received == sizeof(connection.header))
+        {
+            if (connection.header.size > MAX_PAYLOAD)
+            {
+                sendError(fd, "The request is too large", 0);
+                return Reception::CLOSED;
+            }
+            connection.payload.resize(connection.header.size);
+        }
+    }
+}
+
+/// @brief Takes a complete request from the queue, executes it and gives the connection back to the dispatcher, until the queue is closed.
+void workerLoop(BoundedQueue<Request> &requests)
+{
+    Request request;
+    while (requests.pop(request))
+    {
+        bool keep;
+        try
+        {
+            keep = handleRequest(request.fd, request.header, request.payload);
+        }
+        catch (const exception &error)
+        {
+            keep = sendError(request.fd, error.what());
+        }
+        if (!keep)
+        {
+            close(request.fd);
+            continue;
+        }
+        {
+            lock_guard<mutex> lock(returnedMutex);
+            returnedClients.push_back(request.fd);
+        }
+        wakeDispatcher();
+    }
+}
+
+/// @brief Accepts new clients, receives their requests and dispatches the complete ones to the workers, until the server is stopped.
+/// @param connections the connections owned by the dispatcher, closed by the caller
+void dispatchClients(const int listener, BoundedQueue<Request> &requests, unordered_map<int, Connection> &connections)
+{
+    vector<pollfd> watched;
+    while (!stopping)
+    {
+        watched.assign({{listener, POLLIN, 0}, {wakePipe[0], POLLIN, 0}});
+        for (const auto &[fd, connection] : connections)
+        {
+            watched.push_back({fd, POLLIN, 0});
+        }
+        if (poll(watched.data(), watched.size(), -1) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            cout << "poll failed: " << strerror(errno) << endl;
+            return;
+        }
+
+        for (size_t i = 2; i < watched.size(); ++i)
+        {
+            if (watched[i].revents == 0)
+                continue;
+            const int fd = watched[i].fd;
+            Connection &connection = connections[fd];
+            const Reception reception = receiveRequest(fd, connection);
+            if (reception == Reception::PENDING)
+                continue;
+            if (reception == Reception::COMPLETE)
+                requests.push(Request{fd, connection.header, move(connection.payload)});
+            else
+                close(fd);
+            connections.erase(fd);
+        }
+
+        if (watched[1].revents & POLLIN)
+        {
+            char drain[256];
+            while (read(wakePipe[0], drain, sizeof(drain)) > 0)
+            {
+            }
+            lock_guard<mutex> lock(returnedMutex);
+            for (const int fd : returnedClients)
+            {
+                connections[fd] = Connection();
+            }
+            returnedClients.clear();
+        }
+
+        if (watched[0].revents & POLLIN)
+        {
+            const int fd = accept(listener, nullptr, nullptr);
+            if (fd >= 0 && fcntl(fd, F_SETFL, O_NONBLOCK) == 0)
+                connections[fd] = Connection();
+            else if (fd >= 0)
+                close(fd);
+            else if (errno == EMFILE || errno == ENFILE || errno == ENOBUFS || errno == ENOMEM)
+                // Out of descriptors or memory: the pending client stays in the backlog, retrying at once would only spin.
+                this_thread::sleep_for(chrono::milliseconds(100));
+        }
+    }
+}
+
+/// @brief Keeps boards resident in memory and serves load, step, snapshot and query requests over a Unix domain socket,
+/// so interactive tools do not pay for process startup and input parsing on every request.
+/// Options: `--socket=<path>`, `--workers=<threads>` (the number of requests executed at the same time, whatever the number of clients)
+/// and `--engine=<name>` (the backend of the loaded boards, `sparse` by default).
+/// SIGINT or SIGTERM stops the server and removes the socket.
+int main(int argc, char **argv)
+{
+    const string socketPath = getOption(argc, argv, "socket", Protocol::DEFAULT_SOCKET, 1);
+    const int workers = max(1, stoi(getOption(argc, argv, "workers", to_string(max(2u, thread::hardware_concurrency())), 1)));
+    engineName = getOption(argc, argv, "engine", engineName, 1);
+    engineOptions = [argc, argv](const string &name, const string &defaultValue)
+    { return getOption(argc, argv, name, defaultValue, 1); };
+    if (engineRegistry().count(engineName) == 0)
+    {
+        cout << "Unknown engine " << engineName << ", available engines: " << engineNames() << "\n";
+        cout << "Game of life server did not start";
+        return 1;
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+    const int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+    unlink(socketPath.c_str());
+    if (listener < 0 || bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 || listen(listener, SOMAXCONN) != 0 ||
+        pipe(wakePipe) != 0 || fcntl(wakePipe[0], F_SETFL, O_NONBLOCK) != 0 || fcntl(wakePipe[1], F_SETFL, O_NONBLOCK) != 0)
+    {
+        cout << "Could not listen on " << socketPath << "\n";
+        cout << "Game of life server did not start";
+        return 1;
+    }
+    signal(SIGINT, requestStop);
+    signal(SIGTERM, requestStop);
+
+    BoundedQueue<Request> requests(static_cast<size_t>(workers) * 4);
+    vector<thread> pool;
+    for (int i = 0; i < workers; ++i)
+    {
+        pool.emplace_back(workerLoop, ref(requests));
+    }
+    cout << "Game of life server listening on " << socketPath << " with " << workers << " workers" << endl;
+
+    unordered_map<int, Connection> connections;
+    dispatchClients(listener, requests, connections);
+
+    // The requests already dispatched are completed before the connections are closed.
+    requests.close();
+    for (thread &worker : pool)
+    {
+        worker.join();
+    }
+    for (const auto &[fd, connection] : connections)
+    {
+        close(fd);
+    }
+    for (const int fd : returnedClients)
+    {
+        close(fd);
+    }
+    close(listener);
+    unlink(socketPath.c_str());
+    cout << "Game of life server stopped" << endl;
+    return 0;
+}
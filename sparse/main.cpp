@@ -0,0 +1,8 @@
+#include "../engines/Driver.h"
+
+/// @brief Simulates Conway's Game of Life on a sparse board, whose memory scales with the live area instead of the bounding area.
+/// The simulation itself lives in `engines/`; this program runs the `sparse` engine unless `--engine=<name>` picks another one.
+int main(int argc, char **argv)
+{
+	return runGameOfLife(argc, argv, "sparse");
+}
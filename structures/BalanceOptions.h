@@ -0,0 +1,22 @@
+#ifndef BALANCE_OPTIONS_H
+#define BALANCE_OPTIONS_H
+
+#include <string>
+
+using namespace std;
+
+/// @brief How the MPI ranks rebalance their row slabs, set with `--rebalance-interval`, `--imbalance-threshold`, `--rebalance-margin` and `--balance-by`.
+struct BalanceOptions
+{
+    // The number of generations between two load measurements, 0 disables rebalancing.
+    int interval = 0;
+    // Slabs are moved only when the slowest rank carries this many times the mean load.
+    double threshold = 1.2;
+    // ... and when the new slabs are expected to lower the imbalance factor by at least this much, so migrations that buy nothing are skipped.
+    double margin = 0.05;
+    // `rows` weighs rows by whether the kernel sweeps them (a live cell in their neighbourhood), which is what a step costs;
+    // `cells` by the number of live cells in their neighbourhood; `time` by the measured step time of each rank.
+    string metric = "rows";
+};
+
+#endif
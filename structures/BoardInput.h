@@ -0,0 +1,56 @@
+#ifndef BOARD_INPUT_H
+#define BOARD_INPUT_H
+
+#include <string>
+#include <sstream>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+#include "../constants.h"
+
+using namespace std;
+
+/// @brief Reads the content of an input file, shared by every engine. Two formats are accepted:
+/// the dense `0`/`1` string of a square grid, and the sparse format `sparse <size>` followed by one `<row> <col>` pair per live cell,
+/// whose cost only depends on the number of live cells.
+/// @param inputData the content of the input file
+/// @param denseInput set to true when the input used the dense format
+/// @param allocate called once as `allocate(size)` with the number of rows and columns of the board, border excluded, before any cell is visited
+/// @param visit called as `visit(row, col)` for every live cell, border excluded
+template <typename Allocator, typename Visitor>
+void readBoard(const string &inputData, bool &denseInput, Allocator allocate, Visitor visit)
+{
+    const string sparseHeader = "sparse";
+    denseInput = inputData.compare(0, sparseHeader.size(), sparseHeader) != 0;
+    if (denseInput)
+    {
+        const int size = static_cast<int>(sqrt(inputData.size()));
+        const long long cells = min(static_cast<long long>(inputData.size()), static_cast<long long>(size) * size);
+        allocate(size);
+        for (long long i = 0; i < cells; ++i)
+        {
+            if (inputData[i] - '0' == Constants::LIVE)
+                visit(static_cast<int>(i / size), static_cast<int>(i % size));
+        }
+        return;
+    }
+
+    istringstream iss(inputData);
+    string header;
+    int size = 0;
+    iss >> header >> size;
+    if (size <= 0)
+    {
+        throw runtime_error("Invalid board size in sparse input");
+    }
+    allocate(size);
+    int row, col;
+    while (iss >> row >> col)
+    {
+        if (row >= 0 && col >= 0 && row < size && col < size)
+            visit(row, col);
+    }
+}
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef BOUNDED_QUEUE_H
+#define BOUNDED_QUEUE_H
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+
+using namespace std;
+
+/// @brief A fixed-capacity FIFO shared by producer and consumer threads.
+/// `push` blocks while the queue is full, which keeps a fast producer from running ahead of its consumers.
+template <typename T>
+class BoundedQueue
+{
+public:
+    explicit BoundedQueue(const size_t capacity) : _capacity(max<size_t>(capacity, 1)) {}
+
+    void push(T item)
+    {
+        unique_lock<mutex> lock(_mutex);
+        _notFull.wait(lock, [&]
+                      { return _items.size() < _capacity || _closed; });
+        if (_closed)
+            return;
+        _items.push_back(move(item));
+        _notEmpty.notify_one();
+    }
+
+    /// @brief Waits for the next item.
+    /// @return false once the queue is closed and drained
+    bool pop(T &item)
+    {
+        unique_lock<mutex> lock(_mutex);
+        _notEmpty.wait(lock, [&]
+                       { return !_items.empty() || _closed; });
+        if (_items.empty())
+            return false;
+        item = move(_items.front());
+        _items.pop_front();
+        _notFull.notify_one();
+        return true;
+    }
+
+    void close()
+    {
+        lock_guard<mutex> lock(_mutex);
+        _closed = true;
+        _notEmpty.notify_all();
+        _notFull.notify_all();
+    }
+
+private:
+    const size_t _capacity;
+    deque<T> _items;
+    bool _closed = false;
+    mutex _mutex;
+    condition_variable _notEmpty;
+    condition_variable _notFull;
+};
+
+#endif
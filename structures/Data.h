@@ -2,7 +2,9 @@
 #define DATA_H
 
 #include <string>
-#include <vector>
+
+#include "./Region.h"
+#include "./FrameOptions.h"
 
 using namespace std;
 
@@ -10,7 +12,14 @@ struct Data
 {
     string inputFilename;
     int numGenerations;
-    vector<vector<int>> grid;
+    // The backend chosen with `--engine`, see `engineRegistry`.
+    string engine;
+    // true when the board was read from the dense `0`/`1` format, so the output keeps the same layout.
+    bool denseInput;
+    // The window requested with `--query`, empty when the whole board is simulated.
+    Region query;
+    // How generations are exported as images, disabled unless `--frames` is given.
+    FrameOptions frames;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,273 @@
+#ifndef FRAME_EXPORTER_H
+#define FRAME_EXPORTER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <thread>
+#include <fstream>
+#include <filesystem>
+#include <stdexcept>
+#include <algorithm>
+
+#ifdef HAVE_OPENCV
+#include <opencv2/core.hpp>
+#include <opencv2/videoio.hpp>
+#endif
+
+#include "../constants.h"
+#include "./BoundedQueue.h"
+#include "./FrameOptions.h"
+#include "../engines/Engine.h"
+
+using namespace std;
+
+/// @brief A downsampled generation, one grayscale byte per pixel (black is empty, white is fully alive).
+struct Frame
+{
+    int generation = 0;
+    int width = 0;
+    int height = 0;
+    vector<uint8_t> pixels;
+};
+
+/// @brief Writes a grayscale frame as a binary PPM image.
+inline void writePpm(const string &filePath, const Frame &frame)
+{
+    ofstream outfile(filePath, ios::binary);
+    outfile << "P6\n"
+            << frame.width << " " << frame.height << "\n255\n";
+    vector<uint8_t> rgb(frame.pixels.size() * 3);
+    for (size_t i = 0; i < frame.pixels.size(); ++i)
+    {
+        rgb[3 * i] = rgb[3 * i + 1] = rgb[3 * i + 2] = frame.pixels[i];
+    }
+    outfile.write(reinterpret_cast<const char *>(rgb.data()), rgb.size());
+}
+
+/// @brief Writes a grayscale frame as a PNG image. The image data is stored in uncompressed deflate blocks,
+/// which keeps the encoder dependency-free and fast; frames are already small after downsampling.
+inline void writePng(const string &filePath, const Frame &frame)
+{
+    static const vector<uint32_t> crcTable = []
+    {
+        vector<uint32_t> table(256);
+        for (uint32_t n = 0; n < 256; ++n)
+        {
+            uint32_t c = n;
+            for (int k = 0; k < 8; ++k)
+            {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            table[n] = c;
+        }
+        return table;
+    }();
+    const auto putBigEndian = [](vector<uint8_t> &out, const uint32_t value)
+    {
+        for (int shift = 24; shift >= 0; shift -= 8)
+        {
+            out.push_back(static_cast<uint8_t>(value >> shift));
+        }
+    };
+    ofstream outfile(filePath, ios::binary);
+    const auto writeChunk = [&](const char *type, const vector<uint8_t> &data)
+    {
+        vector<uint8_t> chunk;
+        putBigEndian(chunk, static_cast<uint32_t>(data.size()));
+        chunk.insert(chunk.end(), type, type + 4);
+        chunk.insert(chunk.end(), data.begin(), data.end());
+        uint32_t crc = 0xFFFFFFFFu;
+        for (size_t i = 4; i < chunk.size(); ++i)
+        {
+            crc = crcTable[(crc ^ chunk[i]) & 0xFF] ^ (crc >> 8);
+        }
+        putBigEndian(chunk, crc ^ 0xFFFFFFFFu);
+        outfile.write(reinterpret_cast<const char *>(chunk.data()), chunk.size());
+    };
+
+    const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    outfile.write(reinterpret_cast<const char *>(signature), sizeof(signature));
+
+    vector<uint8_t> header;
+    putBigEndian(header, frame.width);
+    putBigEndian(header, frame.height);
+    header.insert(header.end(), {8, 0, 0, 0, 0}); // 8-bit grayscale, no interlacing
+    writeChunk("IHDR", header);
+
+    // Every scanline starts with filter type 0 (none).
+    vector<uint8_t> raw;
+    raw.reserve(static_cast<size_t>(frame.width + 1) * frame.height);
+    for (int row = 0; row < frame.height; ++row)
+    {
+        raw.push_back(0);
+        raw.insert(raw.end(), frame.pixels.begin() + static_cast<size_t>(row) * frame.width, frame.pixels.begin() + static_cast<size_t>(row + 1) * frame.width);
+    }
+    vector<uint8_t> zlib = {0x78, 0x01};
+    const size_t maxBlock = 65535;
+    size_t offset = 0;
+    do
+    {
+        const size_t length = min(maxBlock, raw.size() - offset);
+        zlib.push_back(offset + length == raw.size() ? 1 : 0); // BFINAL on the last stored block
+        zlib.insert(zlib.end(), {static_cast<uint8_t>(length), static_cast<uint8_t>(length >> 8),
+                                 static_cast<uint8_t>(~length), static_cast<uint8_t>(~length >> 8)});
+        zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + length);
+        offset += length;
+    } while (offset < raw.size());
+    uint32_t a = 1, b = 0;
+    for (const uint8_t byte : raw)
+    {
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    putBigEndian(zlib, (b << 16) | a);
+    writeChunk("IDAT", zlib);
+    writeChunk("IEND", {});
+}
+
+/// @brief Exports generations straight from the simulation loop as images or as a video.
+/// The simulation thread only downsamples each board to the target resolution (density-based grayscale binning);
+/// encoding and disk writes happen on a pool of encoder threads fed through a bounded queue.
+class FrameExporter
+{
+public:
+    /// @param options the export format, frame size and number of encoder threads
+    /// @param name the name of the run, used for the output folder or video file
+    FrameExporter(const FrameOptions &options, const string &name)
+        : _options(options), _queue(options.queueCapacity)
+    {
+        if (_options.format != "ppm" && _options.format != "png" && _options.format != "video")
+        {
+            throw runtime_error("Unknown frame format " + _options.format);
+        }
+#ifndef HAVE_OPENCV
+        if (_options.format == "video")
+        {
+            throw runtime_error("Video export needs OpenCV, build with -DHAVE_OPENCV");
+        }
+#endif
+        if (_options.format == "video")
+        {
+            const string folderName = "videos/";
+            filesystem::create_directories(folderName);
+            _path = folderName + name + ".avi";
+            // A video has to be written in order, so it gets a single encoder.
+            _workers.emplace_back(&FrameExporter::videoLoop, this);
+            return;
+        }
+        _path = "frames/" + name + "/";
+        filesystem::create_directories(_path);
+        for (int i = 0; i < max(_options.encoders, 1); ++i)
+        {
+            _workers.emplace_back(&FrameExporter::encoderLoop, this);
+        }
+    }
+
+    ~FrameExporter()
+    {
+        close();
+    }
+
+    FrameExporter(const FrameExporter &) = delete;
+    FrameExporter &operator=(const FrameExporter &) = delete;
+
+    /// @brief Downsamples the board of an engine by visiting its live cells and queues it for encoding.
+    void push(Engine &engine, const int generation)
+    {
+        const int size = engine.size();
+        if (size <= 0)
+            return;
+        const int scale = binSize(size);
+        const int side = frameSide(size, scale);
+        vector<uint64_t> counts(static_cast<size_t>(side) * side, 0);
+        engine.forEachLive([&](const int row, const int col)
+                           { counts[static_cast<size_t>(row / scale) * side + col / scale]++; });
+        _queue.push(toFrame(counts, size, scale, generation));
+    }
+
+    /// @brief Waits until every queued frame is encoded.
+    void close()
+    {
+        _queue.close();
+        for (thread &worker : _workers)
+        {
+            if (worker.joinable())
+                worker.join();
+        }
+    }
+
+private:
+    FrameOptions _options;
+    BoundedQueue<Frame> _queue;
+    vector<thread> _workers;
+    string _path;
+
+    int binSize(const int size) const
+    {
+        const int target = max(_options.targetSize, 1);
+        return (size + target - 1) / target;
+    }
+
+    static int frameSide(const int size, const int scale)
+    {
+        return (size + scale - 1) / scale;
+    }
+
+    /// @brief Turns live-cell counts per bin into grayscale, dividing by the bin area (smaller on the last row and column).
+    /// Bins of large boards hold more than 2^32 cells with a small `--frame-size`, so counts and areas are 64-bit.
+    static Frame toFrame(const vector<uint64_t> &counts, const int size, const int scale, const int generation)
+    {
+        Frame frame;
+        frame.generation = generation;
+        frame.width = frame.height = frameSide(size, scale);
+        frame.pixels.resize(counts.size());
+        for (int row = 0; row < frame.height; ++row)
+        {
+            const int binRows = min(scale, size - row * scale);
+            for (int col = 0; col < frame.width; ++col)
+            {
+                const int binCols = min(scale, size - col * scale);
+                const size_t i = static_cast<size_t>(row) * frame.width + col;
+                frame.pixels[i] = static_cast<uint8_t>(counts[i] * 255 / (static_cast<uint64_t>(binRows) * binCols));
+            }
+        }
+        return frame;
+    }
+
+    void encoderLoop()
+    {
+        Frame frame;
+        while (_queue.pop(frame))
+        {
+            const string number = to_string(frame.generation);
+            const string filePath = _path + "frame_" + string(number.size() < 6 ? 6 - number.size() : 0, '0') + number + "." + _options.format;
+            if (_options.format == "png")
+                writePng(filePath, frame);
+            else
+                writePpm(filePath, frame);
+        }
+    }
+
+    void videoLoop()
+    {
+        Frame frame;
+#ifdef HAVE_OPENCV
+        cv::VideoWriter writer;
+        while (_queue.pop(frame))
+        {
+            if (!writer.isOpened())
+            {
+                writer.open(_path, cv::VideoWriter::fourcc('M', 'J', 'P', 'G'), _options.fps, cv::Size(frame.width, frame.height), false);
+            }
+            writer.write(cv::Mat(frame.height, frame.width, CV_8UC1, frame.pixels.data()));
+        }
+#else
+        while (_queue.pop(frame))
+        {
+        }
+#endif
+    }
+};
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef FRAME_OPTIONS_H
+#define FRAME_OPTIONS_H
+
+#include <string>
+
+using namespace std;
+
+/// @brief How generations are exported as images, set with `--frames`, `--frame-size` and `--encoders`.
+struct FrameOptions
+{
+    // `ppm`, `png` or `video` (needs OpenCV); empty when no frames are exported.
+    string format;
+    // The largest side of an exported frame, in pixels; bigger boards are downsampled.
+    int targetSize = 512;
+    // The number of encoder threads.
+    int encoders = 2;
+    // The number of downsampled frames that may wait for an encoder before the simulation blocks.
+    int queueCapacity = 16;
+    // Frames per second of the exported video.
+    int fps = 10;
+
+    bool enabled() const
+    {
+        return !format.empty();
+    }
+};
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef GENERATION_STATS_H
+#define GENERATION_STATS_H
+
+#include <climits>
+#include <algorithm>
+
+using namespace std;
+
+/// @brief Census of one generation, filled in by the step kernel while it computes the generation.
+/// The bounding box is in grid coordinates (border included) and is empty when no cell is alive.
+struct GenerationStats
+{
+    int generation = 0;
+    long long population = 0;
+    long long births = 0;
+    long long deaths = 0;
+    int minRow = INT_MAX;
+    int minCol = INT_MAX;
+    int maxRow = -1;
+    int maxCol = -1;
+
+    bool empty() const
+    {
+        return maxRow < minRow;
+    }
+
+    void clearBox()
+    {
+        minRow = minCol = INT_MAX;
+        maxRow = maxCol = -1;
+    }
+
+    void includeRow(const int row, const int firstCol, const int lastCol)
+    {
+        minRow = min(minRow, row);
+        maxRow = max(maxRow, row);
+        minCol = min(minCol, firstCol);
+        maxCol = max(maxCol, lastCol);
+    }
+};
+
+#endif
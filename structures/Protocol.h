@@ -0,0 +1,170 @@
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include <cerrno>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <unistd.h>
+
+using namespace std;
+
+/// Binary protocol spoken over the Unix domain socket of the simulation server.
+/// Every request is a `RequestHeader` followed by `size` payload bytes and is answered by a `ReplyHeader`
+/// followed by `size` payload bytes. Integers use the native byte order, since both ends run on the same machine.
+/// Boards are exchanged bit-packed: one row after the other, each row padded to whole bytes, column `c` in bit `c % 8` of byte `c / 8`.
+namespace Protocol
+{
+    const string DEFAULT_SOCKET = "/tmp/gameoflife.sock";
+
+    enum RequestType : uint32_t
+    {
+        // payload: the content of an input file (dense `0`/`1` string or sparse format); reply: uint32 board size, header.board is the new id
+        LOAD = 1,
+        // payload: uint64 number of generations; reply: `StepReply`
+        STEP = 2,
+        // payload: none; reply: uint32 board size followed by the bit-packed board
+        SNAPSHOT = 3,
+        // payload: `QueryRequest`; reply: the bit-packed window
+        QUERY = 4,
+        // payload: none; reply: none
+        FREE = 5,
+    };
+
+    enum Status : uint32_t
+    {
+        OK = 0,
+        // payload: the error message
+        ERROR = 1,
+    };
+
+    struct RequestHeader
+    {
+        uint32_t type;
+        uint32_t board;
+        uint64_t size;
+    };
+
+    struct ReplyHeader
+    {
+        uint32_t status;
+        uint32_t board;
+        uint64_t size;
+    };
+
+    struct StepReply
+    {
+        uint64_t generation;
+        uint64_t population;
+    };
+
+    struct QueryRequest
+    {
+        int32_t x0;
+        int32_t y0;
+        int32_t width;
+        int32_t height;
+    };
+
+    /// @brief The number of bytes of one bit-packed row.
+    inline size_t rowBytes(const int width)
+    {
+        return (static_cast<size_t>(width) + 7) / 8;
+    }
+
+    inline bool cellAt(const uint8_t *bits, const int width, const int row, const int col)
+    {
+        return (bits[row * rowBytes(width) + col / 8] >> (col % 8)) & 1;
+    }
+
+    /// @brief Writes the whole buffer, retrying on short writes.
+    /// @param timeoutMs on a non-blocking socket, how long to wait for the peer to make room (-1 waits forever)
+    /// @return false if the connection was lost or the peer did not read for `timeoutMs`
+    inline bool sendAll(const int fd, const void *data, size_t size, const int timeoutMs = -1)
+    {
+        const char *bytes = static_cast<const char *>(data);
+        while (size > 0)
+        {
+            const ssize_t sent = send(fd, bytes, size, MSG_NOSIGNAL);
+            if (sent < 0 && errno == EINTR)
+                continue;
+            if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            {
+                pollfd writable = {fd, POLLOUT, 0};
+                if (poll(&writable, 1, timeoutMs) > 0)
+                    continue;
+                return false;
+            }
+            if (sent <= 0)
+                return false;
+            bytes += sent;
+            size -= sent;
+        }
+        return true;
+    }
+
+    /// @brief Reads exactly `size` bytes.
+    /// @return false if the peer closed the connection first
+    inline bool recvAll(const int fd, void *data, size_t size)
+    {
+        char *bytes = static_cast<char *>(data);
+        while (size > 0)
+        {
+            const ssize_t received = recv(fd, bytes, size, 0);
+            if (received <= 0)
+                return false;
+            bytes += received;
+            size -= received;
+        }
+        return true;
+    }
+
+    /// @brief Connects to the server listening on `socketPath`.
+    /// @return the connected socket
+    inline int connectToServer(const string &socketPath)
+    {
+        const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+        if (fd < 0 || connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+        {
+            if (fd >= 0)
+                close(fd);
+            throw runtime_error("Could not connect to " + socketPath);
+        }
+        return fd;
+    }
+
+    /// @brief Sends one request and waits for its reply.
+    /// @param reply the reply payload
+    /// @return the reply header; a server error is turned into an exception
+    inline ReplyHeader call(const int fd, const RequestType type, const uint32_t board, const void *payload, const size_t size, vector<uint8_t> &reply)
+    {
+        const RequestHeader request = {type, board, size};
+        ReplyHeader header;
+        if (!sendAll(fd, &request, sizeof(request)) || !sendAll(fd, payload, size) || !recvAll(fd, &header, sizeof(header)))
+        {
+            throw runtime_error("The connection to the server was lost");
+        }
+        reply.resize(header.size);
+        if (!recvAll(fd, reply.data(), reply.size()))
+        {
+            throw runtime_error("The connection to the server was lost");
+        }
+        if (header.status != OK)
+        {
+            throw runtime_error("Server error: " + string(reply.begin(), reply.end()));
+        }
+        return header;
+    }
+}
+
+#endif
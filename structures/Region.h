@@ -0,0 +1,18 @@
+#ifndef REGION_H
+#define REGION_H
+
+/// @brief A rectangular window of the board, in cells, without the added border.
+struct Region
+{
+    int x0 = 0;
+    int y0 = 0;
+    int width = 0;
+    int height = 0;
+
+    bool empty() const
+    {
+        return width <= 0 || height <= 0;
+    }
+};
+
+#endif
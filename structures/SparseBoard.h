@@ -0,0 +1,696 @@
+#ifndef SPARSE_BOARD_H
+#define SPARSE_BOARD_H
+
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <string>
+#include <sstream>
+#include <cmath>
+#include <stdexcept>
+
+#include "../constants.h"
+#include "./GenerationStats.h"
+#include "./BoardInput.h"
+
+using namespace std;
+
+/// @brief A 64x64 block of cells, one bit per cell. Bit `c` of `bits[r]` is the cell on row `r`, column `c` of the chunk.
+struct Chunk
+{
+    static constexpr int SIDE = 64;
+    static constexpr int SHIFT = 6;
+
+    uint64_t bits[SIDE];
+    uint64_t next[SIDE];
+    // Cached pointers to the 8 surrounding chunks (nullptr when the neighbour is not resident), indexed N, NE, E, SE, S, SW, W, NW.
+    Chunk *neighbours[8];
+    int chunkRow;
+    int chunkCol;
+    // Position of the chunk inside `SparseBoard::_active`, used for O(1) removal.
+    size_t activeIndex;
+    // Intrusive free list link used by `ChunkPool`.
+    Chunk *nextFree;
+};
+
+/// @brief Hands out chunks from large preallocated blocks and recycles them through a free list,
+/// so a board whose live area is stable does not touch the system allocator.
+class ChunkPool
+{
+public:
+    static constexpr size_t BLOCK_SIZE = 256;
+
+    ChunkPool() = default;
+
+    /// @brief Takes over the blocks; the source is left empty, without a free list pointing into them.
+    ChunkPool(ChunkPool &&other) noexcept : _blocks(move(other._blocks)), _free(exchange(other._free, nullptr))
+    {
+        other._blocks.clear();
+    }
+
+    ChunkPool &operator=(ChunkPool &&other) noexcept
+    {
+        if (this != &other)
+        {
+            _blocks = move(other._blocks);
+            _free = exchange(other._free, nullptr);
+            other._blocks.clear();
+        }
+        return *this;
+    }
+
+    Chunk *acquire()
+    {
+        if (_free == nullptr)
+        {
+            grow();
+        }
+        Chunk *chunk = _free;
+        _free = chunk->nextFree;
+        return chunk;
+    }
+
+    void release(Chunk *chunk)
+    {
+        chunk->nextFree = _free;
+        _free = chunk;
+    }
+
+    size_t capacity() const
+    {
+        return _blocks.size() * BLOCK_SIZE;
+    }
+
+private:
+    vector<unique_ptr<Chunk[]>> _blocks;
+    Chunk *_free = nullptr;
+
+    void grow()
+    {
+        _blocks.emplace_back(new Chunk[BLOCK_SIZE]);
+        Chunk *block = _blocks.back().get();
+        for (size_t i = 0; i < BLOCK_SIZE; ++i)
+        {
+            block[i].nextFree = (i + 1 < BLOCK_SIZE) ? &block[i + 1] : _free;
+        }
+        _free = block;
+    }
+};
+
+/// @brief Open-addressing (linear probing) hash map from chunk coordinates to resident chunks.
+/// Deletion uses backward shifting, so the table never accumulates tombstones.
+class ChunkMap
+{
+public:
+    ChunkMap() : _slots(64), _count(0) {}
+
+    /// @brief Takes over the table; the source is left as an empty map with a fresh table, so it can still be used.
+    ChunkMap(ChunkMap &&other) : _slots(move(other._slots)), _count(exchange(other._count, 0))
+    {
+        other._slots.assign(64, Slot());
+    }
+
+    ChunkMap &operator=(ChunkMap &&other)
+    {
+        if (this != &other)
+        {
+            _slots = move(other._slots);
+            _count = exchange(other._count, 0);
+            other._slots.assign(64, Slot());
+        }
+        return *this;
+    }
+
+    static uint64_t makeKey(const int chunkRow, const int chunkCol)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(chunkRow)) << 32) | static_cast<uint32_t>(chunkCol);
+    }
+
+    Chunk *find(const uint64_t key) const
+    {
+        const size_t mask = _slots.size() - 1;
+        for (size_t slot = hash(key) & mask;; slot = (slot + 1) & mask)
+        {
+            if (_slots[slot].chunk == nullptr)
+                return nullptr;
+            if (_slots[slot].key == key)
+                return _slots[slot].chunk;
+        }
+    }
+
+    void insert(const uint64_t key, Chunk *chunk)
+    {
+        if (2 * (_count + 1) > _slots.size())
+        {
+            rehash(2 * _slots.size());
+        }
+        place(key, chunk);
+        _count++;
+    }
+
+    void erase(const uint64_t key)
+    {
+        const size_t mask = _slots.size() - 1;
+        size_t slot = hash(key) & mask;
+        while (_slots[slot].key != key)
+        {
+            if (_slots[slot].chunk == nullptr)
+                return;
+            slot = (slot + 1) & mask;
+        }
+        if (_slots[slot].chunk == nullptr)
+            return;
+        // Shift back every following entry of the probe run that would otherwise become unreachable.
+        size_t hole = slot;
+        for (size_t next = (hole + 1) & mask; _slots[next].chunk != nullptr; next = (next + 1) & mask)
+        {
+            const size_t home = hash(_slots[next].key) & mask;
+            if (((next - home) & mask) >= ((next - hole) & mask))
+            {
+                _slots[hole] = _slots[next];
+                hole = next;
+            }
+        }
+        _slots[hole] = Slot();
+        _count--;
+    }
+
+    size_t size() const
+    {
+        return _count;
+    }
+
+private:
+    struct Slot
+    {
+        uint64_t key = 0;
+        Chunk *chunk = nullptr;
+    };
+
+    vector<Slot> _slots;
+    size_t _count;
+
+    static size_t hash(const uint64_t key)
+    {
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> 20);
+    }
+
+    void place(const uint64_t key, Chunk *chunk)
+    {
+        const size_t mask = _slots.size() - 1;
+        size_t slot = hash(key) & mask;
+        while (_slots[slot].chunk != nullptr)
+        {
+            slot = (slot + 1) & mask;
+        }
+        _slots[slot].key = key;
+        _slots[slot].chunk = chunk;
+    }
+
+    void rehash(const size_t capacity)
+    {
+        vector<Slot> old(capacity);
+        old.swap(_slots);
+        for (const Slot &slot : old)
+        {
+            if (slot.chunk != nullptr)
+                place(slot.key, slot.chunk);
+        }
+    }
+};
+
+/// @brief Sparse Game of Life board made of bit-packed 64x64 chunks.
+/// Only chunks holding live cells (plus the fringe needed for births) are resident, so memory scales with the live area.
+/// The board follows the same rules as the dense grid: cells outside [0, size) are dead and,
+/// whenever a live cell reaches the outermost ring, the two outer rows and columns are cleared (see `cleanBoarder`).
+class SparseBoard
+{
+public:
+    explicit SparseBoard(const int size = 0) : _size(size) {}
+
+    /// @brief Copies only the resident chunks; the copy gets its own pool and neighbour links.
+    SparseBoard(const SparseBoard &other) : _size(other._size), _stats(other._stats), _counted(other._counted)
+    {
+        for (const Chunk *chunk : other._active)
+        {
+            Chunk *copy = createChunk(chunk->chunkRow, chunk->chunkCol);
+            copy_n(chunk->bits, Chunk::SIDE, copy->bits);
+        }
+    }
+
+    SparseBoard &operator=(const SparseBoard &other)
+    {
+        if (this != &other)
+        {
+            SparseBoard copy(other);
+            *this = move(copy);
+        }
+        return *this;
+    }
+
+    /// @brief The moved-from board is empty but usable, since the pool and the map reset themselves.
+    SparseBoard(SparseBoard &&) = default;
+    SparseBoard &operator=(SparseBoard &&) = default;
+
+    /// @brief The number of rows and columns of the (square) board, border included.
+    int size() const
+    {
+        return _size;
+    }
+
+    /// @brief The number of resident chunks.
+    size_t chunkCount() const
+    {
+        return _active.size();
+    }
+
+    /// @brief The number of chunks the pool has allocated so far.
+    size_t pooledChunkCount() const
+    {
+        return _pool.capacity();
+    }
+
+    bool get(const int row, const int col) const
+    {
+        const Chunk *chunk = _map.find(ChunkMap::makeKey(row >> Chunk::SHIFT, col >> Chunk::SHIFT));
+        return chunk != nullptr && ((chunk->bits[row & (Chunk::SIDE - 1)] >> (col & (Chunk::SIDE - 1))) & 1);
+    }
+
+    void set(const int row, const int col, const bool alive)
+    {
+        if (static_cast<unsigned>(row) >= static_cast<unsigned>(_size) || static_cast<unsigned>(col) >= static_cast<unsigned>(_size))
+            return;
+        const int chunkRow = row >> Chunk::SHIFT;
+        const int chunkCol = col >> Chunk::SHIFT;
+        Chunk *chunk = _map.find(ChunkMap::makeKey(chunkRow, chunkCol));
+        if (chunk == nullptr)
+        {
+            if (!alive)
+                return;
+            chunk = createChunk(chunkRow, chunkCol);
+        }
+        const uint64_t bit = uint64_t(1) << (col & (Chunk::SIDE - 1));
+        uint64_t &word = chunk->bits[row & (Chunk::SIDE - 1)];
+        word = alive ? (word | bit) : (word & ~bit);
+        _counted = false;
+    }
+
+    /// @brief The census of the current generation, kept up to date by `step` at no extra pass over the board.
+    /// Only a board edited with `set` since the last step is counted again.
+    const GenerationStats &statistics()
+    {
+        if (!_counted)
+        {
+            const int generation = _stats.generation;
+            _stats = census();
+            _stats.generation = generation;
+            _counted = true;
+        }
+        return _stats;
+    }
+
+    /// @brief The number of live cells on the board.
+    long long population() const
+    {
+        long long count = 0;
+        for (const Chunk *chunk : _active)
+        {
+            for (int row = 0; row < Chunk::SIDE; ++row)
+            {
+                count += __builtin_popcountll(chunk->bits[row]);
+            }
+        }
+        return count;
+    }
+
+    /// @brief Calls `visit(row, col)` for every live cell, chunk by chunk (not in row-major order).
+    template <typename Visitor>
+    void forEachLive(Visitor visit) const
+    {
+        for (const Chunk *chunk : _active)
+        {
+            const int baseRow = chunk->chunkRow << Chunk::SHIFT;
+            const int baseCol = chunk->chunkCol << Chunk::SHIFT;
+            for (int row = 0; row < Chunk::SIDE; ++row)
+            {
+                for (uint64_t word = chunk->bits[row]; word != 0; word &= word - 1)
+                {
+                    visit(baseRow + row, baseCol + __builtin_ctzll(word));
+                }
+            }
+        }
+    }
+
+    /// @brief Copies a rectangular region of the board into `out` (row-major, one `LIVE`/`DEAD` byte per cell).
+    /// Each overlapped chunk is looked up once, and missing chunks are skipped.
+    void readRegion(const int row0, const int col0, const int height, const int width, vector<char> &out) const
+    {
+        out.assign(static_cast<size_t>(height) * width, Constants::DEAD);
+        if (height <= 0 || width <= 0)
+            return;
+        const int lastRow = row0 + height - 1;
+        const int lastCol = col0 + width - 1;
+        for (int chunkRow = row0 >> Chunk::SHIFT; chunkRow <= lastRow >> Chunk::SHIFT; ++chunkRow)
+        {
+            for (int chunkCol = col0 >> Chunk::SHIFT; chunkCol <= lastCol >> Chunk::SHIFT; ++chunkCol)
+            {
+                const Chunk *chunk = _map.find(ChunkMap::makeKey(chunkRow, chunkCol));
+                if (chunk == nullptr)
+                    continue;
+                const int firstRow = max(row0, chunkRow << Chunk::SHIFT);
+                const int endRow = min(lastRow + 1, (chunkRow + 1) << Chunk::SHIFT);
+                const int firstCol = max(col0, chunkCol << Chunk::SHIFT);
+                const int endCol = min(lastCol + 1, (chunkCol + 1) << Chunk::SHIFT);
+                for (int row = firstRow; row < endRow; ++row)
+                {
+                    const uint64_t word = chunk->bits[row & (Chunk::SIDE - 1)];
+                    if (word == 0)
+                        continue;
+                    char *cells = &out[static_cast<size_t>(row - row0) * width];
+                    for (int col = firstCol; col < endCol; ++col)
+                    {
+                        cells[col - col0] = (word >> (col & (Chunk::SIDE - 1))) & 1;
+                    }
+                }
+            }
+        }
+    }
+
+    /// @brief Advances the board by one generation.
+    void step()
+    {
+        expand();
+        GenerationStats next;
+        next.generation = _stats.generation + 1;
+        for (Chunk *chunk : _active)
+        {
+            computeNext(chunk, next);
+        }
+        for (Chunk *chunk : _active)
+        {
+            swap(chunk->bits, chunk->next);
+        }
+        cleanBorder(next);
+        evictEmpty();
+        _stats = next;
+        _counted = true;
+    }
+
+    void step(int generations)
+    {
+        while (generations-- > 0)
+        {
+            step();
+        }
+    }
+
+private:
+    int _size;
+    ChunkPool _pool;
+    ChunkMap _map;
+    vector<Chunk *> _active;
+    GenerationStats _stats;
+    bool _counted = true;
+
+    static constexpr int DIRECTIONS[8][2] = {
+        {-1, 0},  // N
+        {-1, 1},  // NE
+        {0, 1},   // E
+        {1, 1},   // SE
+        {1, 0},   // S
+        {1, -1},  // SW
+        {0, -1},  // W
+        {-1, -1}, // NW
+    };
+    enum Direction
+    {
+        N,
+        NE,
+        E,
+        SE,
+        S,
+        SW,
+        W,
+        NW
+    };
+
+    int lastChunk() const
+    {
+        return (_size - 1) >> Chunk::SHIFT;
+    }
+
+    Chunk *createChunk(const int chunkRow, const int chunkCol)
+    {
+        Chunk *chunk = _pool.acquire();
+        fill(begin(chunk->bits), end(chunk->bits), 0);
+        chunk->chunkRow = chunkRow;
+        chunk->chunkCol = chunkCol;
+        chunk->activeIndex = _active.size();
+        _active.push_back(chunk);
+        _map.insert(ChunkMap::makeKey(chunkRow, chunkCol), chunk);
+        // Neighbour pointers are resolved once here, so the step kernel never has to hash.
+        for (int direction = 0; direction < 8; ++direction)
+        {
+            Chunk *neighbour = _map.find(ChunkMap::makeKey(chunkRow + DIRECTIONS[direction][0], chunkCol + DIRECTIONS[direction][1]));
+            chunk->neighbours[direction] = neighbour;
+            if (neighbour != nullptr)
+                neighbour->neighbours[(direction + 4) % 8] = chunk;
+        }
+        return chunk;
+    }
+
+    void destroyChunk(Chunk *chunk)
+    {
+        for (int direction = 0; direction < 8; ++direction)
+        {
+            if (chunk->neighbours[direction] != nullptr)
+                chunk->neighbours[direction]->neighbours[(direction + 4) % 8] = nullptr;
+        }
+        _map.erase(ChunkMap::makeKey(chunk->chunkRow, chunk->chunkCol));
+        Chunk *moved = _active.back();
+        moved->activeIndex = chunk->activeIndex;
+        _active[chunk->activeIndex] = moved;
+        _active.pop_back();
+        _pool.release(chunk);
+    }
+
+    /// @brief Makes resident every missing neighbour chunk that could receive a birth from a live edge cell.
+    void expand()
+    {
+        const size_t resident = _active.size();
+        const int last = lastChunk();
+        for (size_t i = 0; i < resident; ++i)
+        {
+            Chunk *chunk = _active[i];
+            uint64_t any = 0;
+            for (int row = 0; row < Chunk::SIDE; ++row)
+            {
+                any |= chunk->bits[row];
+            }
+            if (any == 0)
+                continue;
+            const uint64_t top = chunk->bits[0];
+            const uint64_t bottom = chunk->bits[Chunk::SIDE - 1];
+            const uint64_t leftBit = 1;
+            const uint64_t rightBit = uint64_t(1) << (Chunk::SIDE - 1);
+            const bool needed[8] = {
+                top != 0,
+                (top & rightBit) != 0,
+                (any & rightBit) != 0,
+                (bottom & rightBit) != 0,
+                bottom != 0,
+                (bottom & leftBit) != 0,
+                (any & leftBit) != 0,
+                (top & leftBit) != 0,
+            };
+            for (int direction = 0; direction < 8; ++direction)
+            {
+                if (!needed[direction] || chunk->neighbours[direction] != nullptr)
+                    continue;
+                const int chunkRow = chunk->chunkRow + DIRECTIONS[direction][0];
+                const int chunkCol = chunk->chunkCol + DIRECTIONS[direction][1];
+                if (chunkRow < 0 || chunkCol < 0 || chunkRow > last || chunkCol > last)
+                    continue;
+                createChunk(chunkRow, chunkCol);
+            }
+        }
+    }
+
+    /// @brief Population and bounding box of the resident chunks, without births and deaths.
+    GenerationStats census() const
+    {
+        GenerationStats stats;
+        for (const Chunk *chunk : _active)
+        {
+            const int baseRow = chunk->chunkRow << Chunk::SHIFT;
+            const int baseCol = chunk->chunkCol << Chunk::SHIFT;
+            for (int row = 0; row < Chunk::SIDE; ++row)
+            {
+                const uint64_t word = chunk->bits[row];
+                if (word == 0)
+                    continue;
+                stats.population += __builtin_popcountll(word);
+                stats.includeRow(baseRow + row, baseCol + __builtin_ctzll(word), baseCol + Chunk::SIDE - 1 - __builtin_clzll(word));
+            }
+        }
+        return stats;
+    }
+
+    /// @brief Computes the next generation of a chunk into `chunk->next` with bit-sliced neighbour counting,
+    /// and adds its population, births, deaths and bounding box to `stats` while the words are still in registers.
+    void computeNext(Chunk *chunk, GenerationStats &stats) const
+    {
+        // Rows -1..64 of the chunk's column band, plus the single cells just west and east of them.
+        uint64_t center[Chunk::SIDE + 2];
+        uint64_t westOf[Chunk::SIDE + 2];
+        uint64_t eastOf[Chunk::SIDE + 2];
+        const Chunk *const *n = chunk->neighbours;
+        const int top = 0;
+        const int bottom = Chunk::SIDE + 1;
+
+        center[top] = n[N] ? n[N]->bits[Chunk::SIDE - 1] : 0;
+        center[bottom] = n[S] ? n[S]->bits[0] : 0;
+        westOf[top] = n[NW] ? n[NW]->bits[Chunk::SIDE - 1] >> (Chunk::SIDE - 1) : 0;
+        westOf[bottom] = n[SW] ? n[SW]->bits[0] >> (Chunk::SIDE - 1) : 0;
+        eastOf[top] = n[NE] ? n[NE]->bits[Chunk::SIDE - 1] & 1 : 0;
+        eastOf[bottom] = n[SE] ? n[SE]->bits[0] & 1 : 0;
+        for (int row = 0; row < Chunk::SIDE; ++row)
+        {
+            center[row + 1] = chunk->bits[row];
+            westOf[row + 1] = n[W] ? n[W]->bits[row] >> (Chunk::SIDE - 1) : 0;
+            eastOf[row + 1] = n[E] ? n[E]->bits[row] & 1 : 0;
+        }
+
+        // Bit `c` of `west[i]` / `east[i]` holds the cell at column c - 1 / c + 1.
+        uint64_t west[Chunk::SIDE + 2];
+        uint64_t east[Chunk::SIDE + 2];
+        for (int i = 0; i < Chunk::SIDE + 2; ++i)
+        {
+            west[i] = (center[i] << 1) | westOf[i];
+            east[i] = (center[i] >> 1) | (eastOf[i] << (Chunk::SIDE - 1));
+        }
+
+        // Cells past the end of the board are always dead.
+        const int last = lastChunk();
+        const int lastIndex = (_size - 1) & (Chunk::SIDE - 1);
+        const uint64_t colMask = chunk->chunkCol == last && lastIndex != Chunk::SIDE - 1 ? (uint64_t(1) << (lastIndex + 1)) - 1 : ~uint64_t(0);
+        const int rows = chunk->chunkRow == last ? lastIndex + 1 : Chunk::SIDE;
+        const int baseRow = chunk->chunkRow << Chunk::SHIFT;
+        const int baseCol = chunk->chunkCol << Chunk::SHIFT;
+
+        for (int row = 0; row < Chunk::SIDE; ++row)
+        {
+            const uint64_t neighbours[8] = {
+                west[row], center[row], east[row],
+                west[row + 1], east[row + 1],
+                west[row + 2], center[row + 2], east[row + 2]};
+            // Per-bit counter: ones and twos are the low bits of the count, fours saturates once it reaches 4.
+            uint64_t ones = 0, twos = 0, fours = 0;
+            for (const uint64_t word : neighbours)
+            {
+                const uint64_t carry = ones & word;
+                ones ^= word;
+                fours |= twos & carry;
+                twos ^= carry;
+            }
+            const uint64_t previous = center[row + 1];
+            const uint64_t word = row < rows ? ~fours & twos & (ones | previous) & colMask : 0;
+            chunk->next[row] = word;
+            if ((word | previous) == 0)
+                continue;
+            stats.births += __builtin_popcountll(word & ~previous);
+            stats.deaths += __builtin_popcountll(previous & ~word);
+            if (word == 0)
+                continue;
+            stats.population += __builtin_popcountll(word);
+            stats.includeRow(baseRow + row, baseCol + __builtin_ctzll(word), baseCol + Chunk::SIDE - 1 - __builtin_clzll(word));
+        }
+    }
+
+    /// @brief Sparse counterpart of `cleanBoarder`: the bounding box in `stats` tells whether a live cell is on the outermost ring,
+    /// and only chunks touching the two outer rows or columns are cleared.
+    /// Runs right after the swap, so `next` still holds the previous generation and the cleared cells can be taken out of `stats`:
+    /// a cell born on the border counts as neither birth nor death.
+    void cleanBorder(GenerationStats &stats)
+    {
+        if (stats.empty() || (stats.minRow > 0 && stats.minCol > 0 && stats.maxRow < _size - 1 && stats.maxCol < _size - 1))
+            return;
+
+        const int edges[4] = {0, 1, _size - 2, _size - 1};
+        const int firstInner = 1 >> Chunk::SHIFT;
+        const int lastInner = (_size - 2) >> Chunk::SHIFT;
+        const auto touchesBorder = [&](const Chunk *chunk)
+        {
+            return chunk->chunkRow <= firstInner || chunk->chunkCol <= firstInner ||
+                   chunk->chunkRow >= lastInner || chunk->chunkCol >= lastInner;
+        };
+        const auto clear = [&](Chunk *chunk, const int row, const uint64_t mask)
+        {
+            const uint64_t cleared = chunk->bits[row] & ~mask;
+            stats.births -= __builtin_popcountll(cleared & ~chunk->next[row]);
+            stats.deaths += __builtin_popcountll(cleared & chunk->next[row]);
+            chunk->bits[row] &= mask;
+        };
+
+        for (Chunk *chunk : _active)
+        {
+            if (!touchesBorder(chunk))
+                continue;
+            for (const int edge : edges)
+            {
+                if (edge >> Chunk::SHIFT == chunk->chunkRow)
+                    clear(chunk, edge & (Chunk::SIDE - 1), 0);
+                if (edge >> Chunk::SHIFT == chunk->chunkCol)
+                {
+                    const uint64_t mask = ~(uint64_t(1) << (edge & (Chunk::SIDE - 1)));
+                    for (int row = 0; row < Chunk::SIDE; ++row)
+                    {
+                        clear(chunk, row, mask);
+                    }
+                }
+            }
+        }
+        const GenerationStats cleaned = census();
+        stats.population = cleaned.population;
+        stats.minRow = cleaned.minRow;
+        stats.minCol = cleaned.minCol;
+        stats.maxRow = cleaned.maxRow;
+        stats.maxCol = cleaned.maxCol;
+    }
+
+    /// @brief Returns chunks without live cells to the pool.
+    void evictEmpty()
+    {
+        for (size_t i = _active.size(); i-- > 0;)
+        {
+            Chunk *chunk = _active[i];
+            uint64_t any = 0;
+            for (int row = 0; row < Chunk::SIDE; ++row)
+            {
+                any |= chunk->bits[row];
+            }
+            if (any == 0)
+                destroyChunk(chunk);
+        }
+    }
+};
+
+/// @brief Builds a board, border included, from the content of an input file (see `readBoard` for the accepted formats).
+/// @param inputData the content of the input file
+/// @param denseInput set to true when the input used the dense format
+/// @return the board with the border already added
+inline SparseBoard loadSparseBoard(const string &inputData, bool &denseInput)
+{
+    SparseBoard board;
+    readBoard(
+        inputData, denseInput,
+        [&](const int size)
+        { board = SparseBoard(size + 2 * Constants::BORDER_SIZE); },
+        [&](const int row, const int col)
+        { board.set(row + Constants::BORDER_SIZE, col + Constants::BORDER_SIZE, true); });
+    return board;
+}
+
+#endif
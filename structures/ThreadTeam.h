@@ -0,0 +1,167 @@
+#ifndef THREAD_TEAM_H
+#define THREAD_TEAM_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+/// @brief A fixed team of threads that runs the same job on every member, the calling thread being member 0.
+/// The workers stay alive between jobs, so a simulation step only pays for two synchronisations instead of thread creation.
+/// On Linux every member of a team larger than one is pinned to one CPU of the process affinity mask (the calling thread only during `run`),
+/// so the team stays on the cores (and NUMA node) the launcher bound the process to, and memory first touched by a member stays local to it.
+/// When the mask covers the whole node (the process was not bound), the teams of the processes sharing the node get consecutive, disjoint
+/// blocks of CPUs; if they do not all fit, or the processes of the node are not known, nothing is pinned and the scheduler places the threads.
+class ThreadTeam
+{
+public:
+    /// @param size the number of members, the calling thread included
+    /// @param localRank, localProcesses the index of the process among the processes sharing the node, and their number
+    explicit ThreadTeam(const int size, const int localRank = 0, const int localProcesses = 1) : _size(size > 0 ? size : 1)
+    {
+#ifdef __linux__
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0)
+        {
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+            {
+                if (CPU_ISSET(cpu, &allowed))
+                    _cpus.push_back(cpu);
+            }
+        }
+        const long online = sysconf(_SC_NPROCESSORS_ONLN);
+        if (online > 0 && static_cast<long>(_cpus.size()) >= online && localProcesses > 1)
+        {
+            // Unbound processes all see every CPU: pinning them all to the first CPUs would oversubscribe those and leave the others idle.
+            if (static_cast<size_t>(localProcesses) * _size <= _cpus.size())
+                _cpus.erase(_cpus.begin(), _cpus.begin() + static_cast<size_t>(localRank) * _size);
+            else
+                _cpus.clear();
+        }
+#else
+        (void)localRank;
+        (void)localProcesses;
+#endif
+        for (int member = 1; member < _size; ++member)
+        {
+            _workers.emplace_back(&ThreadTeam::workerLoop, this, member);
+        }
+    }
+
+    ~ThreadTeam()
+    {
+        {
+            lock_guard<mutex> lock(_mutex);
+            _stop = true;
+            _generation++;
+        }
+        _start.notify_all();
+        for (thread &worker : _workers)
+        {
+            worker.join();
+        }
+    }
+
+    ThreadTeam(const ThreadTeam &) = delete;
+    ThreadTeam &operator=(const ThreadTeam &) = delete;
+
+    int size() const
+    {
+        return _size;
+    }
+
+    /// @brief Runs `job(member)` on every member of the team and returns once all of them are done.
+    /// The calling thread is only pinned while it runs its part of the job, so the threads it starts later (e.g. frame encoders)
+    /// inherit its original affinity instead of a single CPU.
+    void run(const function<void(int)> &job)
+    {
+        if (_size == 1)
+        {
+            job(0);
+            return;
+        }
+        {
+            lock_guard<mutex> lock(_mutex);
+            _job = &job;
+            _pending = _size - 1;
+            _generation++;
+        }
+        _start.notify_all();
+#ifdef __linux__
+        cpu_set_t original;
+        const bool restore = !_cpus.empty() && pthread_getaffinity_np(pthread_self(), sizeof(original), &original) == 0;
+        if (restore)
+            pin(0);
+#endif
+        job(0);
+#ifdef __linux__
+        if (restore)
+            pthread_setaffinity_np(pthread_self(), sizeof(original), &original);
+#endif
+        unique_lock<mutex> lock(_mutex);
+        _done.wait(lock, [&]
+                   { return _pending == 0; });
+        _job = nullptr;
+    }
+
+private:
+    const int _size;
+    vector<int> _cpus;
+    vector<thread> _workers;
+    mutex _mutex;
+    condition_variable _start;
+    condition_variable _done;
+    const function<void(int)> *_job = nullptr;
+    long long _generation = 0;
+    int _pending = 0;
+    bool _stop = false;
+
+    void pin(const int member) const
+    {
+#ifdef __linux__
+        if (_cpus.empty())
+            return;
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(_cpus[member % _cpus.size()], &cpus);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+#endif
+    }
+
+    void workerLoop(const int member)
+    {
+        pin(member);
+        long long seen = 0;
+        while (true)
+        {
+            const function<void(int)> *job;
+            {
+                unique_lock<mutex> lock(_mutex);
+                _start.wait(lock, [&]
+                            { return _generation != seen; });
+                seen = _generation;
+                if (_stop)
+                    return;
+                job = _job;
+            }
+            (*job)(member);
+            {
+                lock_guard<mutex> lock(_mutex);
+                _pending--;
+            }
+            _done.notify_one();
+        }
+    }
+};
+
+#endif
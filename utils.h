@@ -0,0 +1,147 @@
+#ifndef UTILS_H
+#define UTILS_H
+
+#include <vector>
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <filesystem>
+
+#include "./constants.h"
+#include "./structures/FrameOptions.h"
+#include "./structures/GenerationStats.h"
+
+using namespace chrono;
+using namespace std;
+using namespace Constants;
+namespace fs = filesystem;
+
+/// @brief Prints the elements of the 2D grid in the console.
+/// @param grid vector<vector<int>> &
+inline void printGrid(vector<vector<int>> &grid)
+{
+    const int cols = grid[0].size();
+    const int rows = grid.size();
+    if (rows <= 2 * BORDER_SIZE || cols <= 2 * BORDER_SIZE)
+        return;
+    for (int row = BORDER_SIZE; row < rows - BORDER_SIZE; ++row)
+    {
+        for (int col = BORDER_SIZE; col < cols - BORDER_SIZE; ++col)
+        {
+            cout << grid[row][col] << " ";
+        }
+        cout << endl;
+    }
+    cout << endl;
+}
+
+/// @brief Sets the standard output (stdout) stream of the C++ interpreter to write to a file.
+/// @param inputFilename the name of the input file
+inline void setSysStdout(const string &inputFilename, const int numGenerations)
+{
+    string folderName = "time_measurements/";
+    if (!fs::exists(folderName))
+    {
+        fs::create_directory(folderName);
+    }
+    string fileExtension = ".txt";
+    const string timeMeasurementsFileame = inputFilename + "_" + to_string(numGenerations);
+    string filePath = folderName + timeMeasurementsFileame + fileExtension;
+    freopen(filePath.c_str(), "a", stdout);
+}
+
+/// @brief Measures the execution time of the methods that I have as a target.
+/// @param times time points of the methods that I have as a target.
+inline void measureExecutionTime(vector<high_resolution_clock::time_point> &timePoints)
+{
+    auto elapsedPrepareGameOfLife = duration_cast<nanoseconds>(timePoints[1] - timePoints[0]);
+    auto elapsedSaveGameOfLife = duration_cast<nanoseconds>(timePoints[2] - timePoints[1]);
+    auto elapsedPlayGameOfLife = duration_cast<nanoseconds>(timePoints[3] - timePoints[2]);
+    cout << "Function prepareGameOfLife = " << elapsedPrepareGameOfLife.count() * 1e-9 << " seconds\n";
+    cout << "Function saveGameOfLife = " << elapsedSaveGameOfLife.count() * 1e-9 << " seconds\n";
+    cout << "Function playGameOfLife = " << elapsedPlayGameOfLife.count() * 1e-9 << " seconds\n";
+}
+
+/// @brief Reads the content of the input file as a string.
+/// @param filename the name of the input file
+/// @return the string representation of the grid
+inline string readFile(const string &filename)
+{
+    ifstream file("../../inputData/" + filename + ".txt");
+    if (!file.is_open())
+    {
+        throw runtime_error("Could not open file " + filename + ".txt");
+    }
+    stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+/// @brief Looks for an optional `--name=value` command-line argument, by default after the input filename and the number of generations.
+/// @param argc the number of arguments entered on the command line
+/// @param argv the arguments entered on the command line
+/// @param name the name of the option, without the leading dashes
+/// @param defaultValue the value returned when the option is missing
+/// @param firstOption the index of the first argument that may be an option
+/// @return the value of the option
+inline string getOption(int argc, char **argv, const string &name, const string &defaultValue = "", const int firstOption = 3)
+{
+    const string prefix = "--" + name + "=";
+    for (int i = firstOption; i < argc; ++i)
+    {
+        const string argument = argv[i];
+        if (argument.compare(0, prefix.size(), prefix) == 0)
+        {
+            return argument.substr(prefix.size());
+        }
+    }
+    return defaultValue;
+}
+
+/// @brief Reads the frame export options: `--frames=ppm|png|video`, `--frame-size=<pixels>` and `--encoders=<threads>`.
+/// @param argc the number of arguments entered on the command line
+/// @param argv the arguments entered on the command line
+/// @return the frame export options, disabled when `--frames` is missing
+inline FrameOptions getFrameOptions(int argc, char **argv)
+{
+    FrameOptions options;
+    options.format = getOption(argc, argv, "frames");
+    options.targetSize = stoi(getOption(argc, argv, "frame-size", to_string(options.targetSize)));
+    options.encoders = stoi(getOption(argc, argv, "encoders", to_string(options.encoders)));
+    options.fps = stoi(getOption(argc, argv, "fps", to_string(options.fps)));
+    return options;
+}
+
+/// @brief Opens the per-generation statistics file of a run and writes its header.
+/// @param inputFilename the name of the input file
+/// @param numGenerations the number of generations
+/// @return the statistics file
+inline ofstream openStatisticsFile(const string &inputFilename, const int numGenerations)
+{
+    const string folderName = "statistics/";
+    if (!fs::exists(folderName))
+    {
+        fs::create_directory(folderName);
+    }
+    ofstream outfile(folderName + inputFilename + "_" + to_string(numGenerations) + ".csv");
+    outfile << "generation,population,births,deaths,min_row,min_col,max_row,max_col\n";
+    return outfile;
+}
+
+/// @brief Appends the statistics of one generation; the bounding box is written without the border offset
+/// (so cells on the border have negative or out-of-range coordinates) and left empty when no cell is alive.
+/// @param outfile the statistics file
+/// @param stats the statistics of the generation
+inline void saveGenerationStats(ofstream &outfile, const GenerationStats &stats)
+{
+    outfile << stats.generation << "," << stats.population << "," << stats.births << "," << stats.deaths << ",";
+    if (stats.empty())
+    {
+        outfile << ",,,\n";
+        return;
+    }
+    outfile << stats.minRow - BORDER_SIZE << "," << stats.minCol - BORDER_SIZE << ","
+            << stats.maxRow - BORDER_SIZE << "," << stats.maxCol - BORDER_SIZE << "\n";
+}
+
+#endif
@@ -0,0 +1,536 @@
+// The header files for input-output operations, containers, random numbers, processes and timing have been included.
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <map>
+#include <iomanip>
+#include <random>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <stdexcept>
+
+#include "../engines/EngineRegistry.h"
+#include "../utils.h"
+
+using namespace std;
+using namespace chrono;
+
+/// Differential verification of the engines and performance regression gate.
+/// Every engine runs a corpus of patterns and the hash and census of each generation are compared with the reference kernel
+/// (`getNextGrid` followed by `cleanBoarder`); then the throughput of every engine (cells per second) is compared with a stored baseline.
+/// Programs compiled with `-DHAVE_MPI` (and mpic++) also check the mpi engine, by launching themselves through a local `mpirun`.
+
+/// @brief A corpus entry: the content of an input file and the number of generations to check.
+struct Pattern
+{
+	string name;
+	string inputData;
+	int generations;
+};
+
+/// @brief The expected hash and census of one generation.
+struct Snapshot
+{
+	uint64_t hash;
+	GenerationStats stats;
+};
+
+/// @brief The outcome of one engine: the number of patterns that did not match the reference and its throughput.
+struct Result
+{
+	string engine;
+	bool completed = true;
+	int failures = 0;
+	double cellsPerSecond = 0;
+};
+
+/// @brief The options of the run, see `main`.
+struct Settings
+{
+	int perfSize = 512;
+	int perfGenerations = 50;
+	int repeats = 3;
+};
+
+/// @brief A random dense input.
+/// @param size the number of rows and columns
+/// @param density the probability of a cell being alive
+/// @param seed the seed of the generator, so every process builds the same corpus
+string makeSoup(const int size, const double density, const unsigned seed)
+{
+	mt19937 generator(seed);
+	bernoulli_distribution alive(density);
+	string inputData(static_cast<size_t>(size) * size, '0');
+	for (char &cell : inputData)
+	{
+		if (alive(generator))
+			cell = '1';
+	}
+	return inputData;
+}
+
+/// @brief Adds a copy of a shape to a list of live cells.
+/// @param shape the live cells of the shape, relative to its top left corner
+/// @param originRow, originCol the top left corner of the copy
+void place(vector<pair<int, int>> &cells, const vector<pair<int, int>> &shape, const int originRow, const int originCol)
+{
+	for (const auto &[row, col] : shape)
+	{
+		cells.emplace_back(originRow + row, originCol + col);
+	}
+}
+
+/// @brief A sparse input.
+/// @param size the number of rows and columns
+/// @param cells the live cells
+string makeSparse(const int size, const vector<pair<int, int>> &cells)
+{
+	ostringstream inputData;
+	inputData << "sparse " << size << "\n";
+	for (const auto &[row, col] : cells)
+	{
+		inputData << row << " " << col << "\n";
+	}
+	return inputData.str();
+}
+
+/// @brief A glider moving towards one of the four corners.
+/// @param down true if it moves towards the bottom
+/// @param right true if it moves towards the right
+vector<pair<int, int>> glider(const bool down, const bool right)
+{
+	const vector<pair<int, int>> southEast = {{0, 1}, {1, 2}, {2, 0}, {2, 1}, {2, 2}};
+	vector<pair<int, int>> cells;
+	for (const auto &[row, col] : southEast)
+	{
+		cells.emplace_back(down ? row : 2 - row, right ? col : 2 - col);
+	}
+	return cells;
+}
+
+/// @brief The patterns every engine is checked on: random soups of several sizes and densities (sizes that are not multiples
+/// of the sparse chunks, nor of the number of ranks), a Gosper glider gun whose gliders reach the corner, gliders hitting each edge and corner,
+/// which exercise the border cleaning, and a large sparse board.
+vector<Pattern> makeCorpus()
+{
+	vector<Pattern> corpus;
+	corpus.push_back({"soup-32", makeSoup(32, 0.5, 1), 100});
+	corpus.push_back({"soup-150", makeSoup(150, 0.3, 2), 100});
+	corpus.push_back({"soup-257", makeSoup(257, 0.35, 3), 60});
+
+	const vector<pair<int, int>> gosperGun = {
+		{0, 24}, {1, 22}, {1, 24}, {2, 12}, {2, 13}, {2, 20}, {2, 21}, {2, 34}, {2, 35}, {3, 11}, {3, 15}, {3, 20}, {3, 21}, {3, 34}, {3, 35}, {4, 0}, {4, 1}, {4, 10}, {4, 16}, {4, 20}, {4, 21}, {5, 0}, {5, 1}, {5, 10}, {5, 14}, {5, 16}, {5, 17}, {5, 22}, {5, 24}, {6, 10}, {6, 16}, {6, 24}, {7, 11}, {7, 15}, {8, 12}, {8, 13}};
+	vector<pair<int, int>> gun;
+	place(gun, gosperGun, 1, 1);
+	corpus.push_back({"gosper-gun", makeSparse(80, gun), 300});
+
+	// A glider reaching each edge long before any other one, since clearing the border for one edge hides a missed check on another,
+	// then gliders leaving through the four corners, starting on the first and last rows and columns.
+	const vector<pair<string, pair<pair<int, int>, pair<bool, bool>>>> edgeGliders = {
+		{"top", {{10, 16}, {false, true}}}, {"bottom", {{35, 30}, {true, false}}}, {"left", {{16, 8}, {true, false}}}, {"right", {{30, 38}, {false, true}}}};
+	for (const auto &[edge, start] : edgeGliders)
+	{
+		vector<pair<int, int>> cells;
+		place(cells, glider(start.second.first, start.second.second), start.first.first, start.first.second);
+		corpus.push_back({"glider-" + edge, makeSparse(48, cells), 80});
+	}
+	vector<pair<int, int>> corners;
+	place(corners, glider(false, false), 0, 0);
+	place(corners, glider(false, true), 0, 45);
+	place(corners, glider(true, false), 45, 0);
+	place(corners, glider(true, true), 45, 45);
+	corpus.push_back({"glider-corners", makeSparse(48, corners), 40});
+
+	vector<pair<int, int>> fleet;
+	for (int i = 0; i < 12; ++i)
+	{
+		place(fleet, glider(true, false), 40 + 80 * i, 900 - 75 * i);
+	}
+	corpus.push_back({"sparse-gliders-1000", makeSparse(1000, fleet), 100});
+	return corpus;
+}
+
+/// @brief FNV-1a hash of a sequence of cells.
+void hashCells(uint64_t &hash, const char *cells, const size_t count)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		hash = (hash ^ static_cast<unsigned char>(cells[i])) * 1099511628211ull;
+	}
+}
+
+const uint64_t HASH_SEED = 14695981039346656037ull;
+
+/// @brief Hashes the board of an engine without its border, read in bands of rows. Collective, the hash is only valid on the root process.
+uint64_t hashBoard(Engine &engine, vector<char> &cells)
+{
+	const int size = engine.size();
+	const int band = 64;
+	uint64_t hash = HASH_SEED;
+	for (int firstRow = 0; firstRow < size; firstRow += band)
+	{
+		engine.readRegion(Region{0, firstRow, size, min(band, size - firstRow)}, cells);
+		hashCells(hash, cells.data(), cells.size());
+	}
+	return hash;
+}
+
+/// @brief Hashes a bordered grid of the reference kernel the same way as `hashBoard`.
+uint64_t hashGrid(const vector<vector<int>> &grid)
+{
+	const int size = static_cast<int>(grid.size());
+	vector<char> cells(max(0, size - 2 * BORDER_SIZE));
+	uint64_t hash = HASH_SEED;
+	for (int row = BORDER_SIZE; row < size - BORDER_SIZE; ++row)
+	{
+		copy(grid[row].begin() + BORDER_SIZE, grid[row].end() - BORDER_SIZE, cells.begin());
+		hashCells(hash, cells.data(), cells.size());
+	}
+	return hash;
+}
+
+/// @brief Runs the reference kernel on a pattern.
+/// @return the hash and census of every generation, from 0 to the number of generations of the pattern
+vector<Snapshot> computeExpected(const Pattern &pattern)
+{
+	vector<vector<int>> grid;
+	bool denseInput;
+	readBoard(
+		pattern.inputData, denseInput,
+		[&](const int size)
+		{ grid.assign(size + 2 * BORDER_SIZE, vector<int>(size + 2 * BORDER_SIZE, DEAD)); },
+		[&](const int row, const int col)
+		{ grid[row + BORDER_SIZE][col + BORDER_SIZE] = LIVE; });
+
+	vector<Snapshot> expected;
+	expected.push_back({hashGrid(grid), computeStats(grid)});
+	for (int generation = 1; generation <= pattern.generations; ++generation)
+	{
+		vector<vector<int>> nextGrid = getNextGrid(grid);
+		cleanBoarder(nextGrid);
+		GenerationStats stats = computeStats(nextGrid);
+		for (size_t row = 0; row < grid.size(); ++row)
+		{
+			for (size_t col = 0; col < grid.size(); ++col)
+			{
+				stats.births += grid[row][col] == DEAD && nextGrid[row][col] == LIVE;
+				stats.deaths += grid[row][col] == LIVE && nextGrid[row][col] == DEAD;
+			}
+		}
+		grid = move(nextGrid);
+		expected.push_back({hashGrid(grid), stats});
+	}
+	return expected;
+}
+
+/// @brief Describes the first difference between the census of an engine and the expected one, empty when they match.
+string compareStats(const GenerationStats &expected, const GenerationStats &actual)
+{
+	const auto differ = [](const string &name, const long long expectedValue, const long long actualValue)
+	{ return name + " " + to_string(actualValue) + " instead of " + to_string(expectedValue); };
+	if (expected.population != actual.population)
+		return differ("population", expected.population, actual.population);
+	if (expected.births != actual.births)
+		return differ("births", expected.births, actual.births);
+	if (expected.deaths != actual.deaths)
+		return differ("deaths", expected.deaths, actual.deaths);
+	if (expected.empty() != actual.empty() ||
+		(!expected.empty() && (expected.minRow != actual.minRow || expected.minCol != actual.minCol || expected.maxRow != actual.maxRow || expected.maxCol != actual.maxCol)))
+	{
+		return "bounding box (" + to_string(actual.minRow) + "," + to_string(actual.minCol) + ")-(" + to_string(actual.maxRow) + "," + to_string(actual.maxCol) +
+			   ") instead of (" + to_string(expected.minRow) + "," + to_string(expected.minCol) + ")-(" + to_string(expected.maxRow) + "," + to_string(expected.maxCol) + ")";
+	}
+	return "";
+}
+
+/// @brief Steps an engine through a pattern one generation at a time and compares every generation with the reference.
+/// Every generation is run even after a mismatch, so the processes of a distributed engine stay in step.
+/// @return true if every generation matched (only meaningful on the root process)
+bool verifyPattern(Engine &engine, const string &label, const Pattern &pattern, const vector<Snapshot> &expected)
+{
+	engine.load(pattern.inputData);
+	vector<char> cells;
+	string mismatch;
+	for (int generation = 0; generation <= pattern.generations; ++generation)
+	{
+		if (generation > 0)
+			engine.step(1);
+		const uint64_t hash = hashBoard(engine, cells);
+		const GenerationStats stats = engine.statistics();
+		if (!engine.isRoot() || !mismatch.empty())
+			continue;
+		mismatch = compareStats(expected[generation].stats, stats);
+		if (mismatch.empty() && hash != expected[generation].hash)
+			mismatch = "board hash differs";
+		if (!mismatch.empty())
+			mismatch = "FAIL at generation " + to_string(generation) + ": " + mismatch;
+	}
+	if (engine.isRoot())
+	{
+		cout << label << " " << pattern.name << " (" << pattern.generations << " generations): " << (mismatch.empty() ? "ok" : mismatch) << endl;
+	}
+	return mismatch.empty();
+}
+
+/// @brief Measures the throughput of an engine on a random soup, keeping the best of several runs.
+/// @return the number of cell updates per second (only meaningful on the root process)
+double measureThroughput(Engine &engine, const Settings &settings)
+{
+	const string inputData = engine.isRoot() ? makeSoup(settings.perfSize, 0.3, 42) : "";
+	double best = 0;
+	for (int repeat = 0; repeat < settings.repeats; ++repeat)
+	{
+		engine.load(inputData);
+		engine.statistics();
+		const auto start = high_resolution_clock::now();
+		engine.step(settings.perfGenerations);
+		// The census is collective, so on a distributed engine every process has finished the generations when it returns.
+		engine.statistics();
+		const double seconds = duration_cast<nanoseconds>(high_resolution_clock::now() - start).count() * 1e-9;
+		best = max(best, static_cast<double>(settings.perfSize) * settings.perfSize * settings.perfGenerations / max(seconds, 1e-9));
+	}
+	return best;
+}
+
+/// @brief Verifies an engine on the whole corpus, then measures its throughput.
+/// @param name the name of the engine in the registry
+/// @param label the name of the engine in the report and the baseline
+/// @param expected the reference of every pattern of the corpus, only needed on the root process
+Result runEngine(const string &name, const string &label, const EngineOptions &options, const Settings &settings,
+				 const vector<Pattern> &corpus, const vector<vector<Snapshot>> &expected)
+{
+	unique_ptr<Engine> engine = createEngine(name, options);
+	Result result;
+	result.engine = label;
+	for (size_t i = 0; i < corpus.size(); ++i)
+	{
+		if (!verifyPattern(*engine, label, corpus[i], engine->isRoot() ? expected[i] : vector<Snapshot>()))
+			result.failures++;
+	}
+	result.cellsPerSecond = measureThroughput(*engine, settings);
+	if (engine->isRoot())
+	{
+		cout << label << " throughput: " << result.cellsPerSecond << " cells/s" << endl;
+	}
+	return result;
+}
+
+/// @brief Reads the baseline file: one `<engine> <cells per second>` line per engine.
+map<string, double> loadBaseline(const string &path)
+{
+	map<string, double> baseline;
+	ifstream infile(path);
+	string engine;
+	double cellsPerSecond;
+	while (infile >> engine >> cellsPerSecond)
+	{
+		baseline[engine] = cellsPerSecond;
+	}
+	return baseline;
+}
+
+/// @brief Writes the baseline file, keeping the entries of engines that were not measured or did not match the reference.
+void saveBaseline(const string &path, map<string, double> baseline, const vector<Result> &results)
+{
+	for (const Result &result : results)
+	{
+		if (result.completed && result.failures == 0)
+			baseline[result.engine] = result.cellsPerSecond;
+	}
+	ofstream outfile(path);
+	if (!outfile)
+	{
+		throw runtime_error("Could not open " + path);
+	}
+	for (const auto &[engine, cellsPerSecond] : baseline)
+	{
+		outfile << engine << " " << cellsPerSecond << "\n";
+	}
+}
+
+/// @brief Splits a comma-separated list.
+vector<string> splitList(const string &list)
+{
+	vector<string> items;
+	istringstream iss(list);
+	string item;
+	while (getline(iss, item, ','))
+	{
+		if (!item.empty())
+			items.push_back(item);
+	}
+	return items;
+}
+
+#ifdef HAVE_MPI
+/// @brief The program started by `launchMpi` on every rank: verifies the mpi engine, and rank 0 reports the result on its last line.
+int runWorker(int argc, char **argv, const Settings &settings)
+{
+	int provided, rank, ranks;
+	MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+	MPI_Comm_size(MPI_COMM_WORLD, &ranks);
+	const vector<Pattern> corpus = makeCorpus();
+	vector<vector<Snapshot>> expected;
+	for (const Pattern &pattern : corpus)
+	{
+		expected.push_back(rank == 0 ? computeExpected(pattern) : vector<Snapshot>());
+	}
+	const EngineOptions options = [argc, argv](const string &name, const string &defaultValue)
+	{ return getOption(argc, argv, name, defaultValue, 1); };
+	try
+	{
+		const Result result = runEngine("mpi", "mpi/np" + to_string(ranks), options, settings, corpus, expected);
+		if (rank == 0)
+		{
+			cout << "result " << result.engine << " " << result.failures << " " << result.cellsPerSecond << endl;
+		}
+	}
+	catch (const exception &error)
+	{
+		cout << error.what() << endl;
+		MPI_Abort(MPI_COMM_WORLD, 1);
+	}
+	MPI_Finalize();
+	return 0;
+}
+
+/// @brief Runs the mpi engine on `ranks` local processes, by starting this program again through `mpirun`.
+/// Everything the ranks print is forwarded, except the result line.
+/// @param mpirun the launcher, e.g. `mpirun` or `mpirun --oversubscribe`
+Result launchMpi(const string &mpirun, const int ranks, int argc, char **argv)
+{
+	string command = mpirun + " -np " + to_string(ranks) + " " + argv[0];
+	for (int i = 1; i < argc; ++i)
+	{
+		command += " '" + string(argv[i]) + "'";
+	}
+	command += " --worker=mpi 2>&1";
+
+	Result result;
+	result.engine = "mpi/np" + to_string(ranks);
+	result.completed = false;
+	FILE *pipe = popen(command.c_str(), "r");
+	if (pipe == nullptr)
+	{
+		throw runtime_error("Could not run " + command);
+	}
+	char buffer[4096];
+	while (fgets(buffer, sizeof(buffer), pipe) != nullptr)
+	{
+		const string line = buffer;
+		istringstream iss(line);
+		string tag;
+		if (iss >> tag && tag == "result")
+			result.completed = static_cast<bool>(iss >> result.engine >> result.failures >> result.cellsPerSecond);
+		else
+			cout << line;
+	}
+	if (pclose(pipe) != 0)
+	{
+		result.completed = false;
+	}
+	return result;
+}
+#endif
+
+/// @brief Checks every engine against the reference kernel, then checks their throughput against the baseline.
+/// Options:
+/// `--engines=<names>` the engines run in this process, all registered ones except mpi by default;
+/// `--mpi-ranks=<counts>` the numbers of ranks the mpi engine is launched on (`2,4` by default, programs built with `-DHAVE_MPI` only);
+/// `--mpirun=<launcher>` the command used to start them (`mpirun` by default);
+/// `--baseline=<file>` the stored throughputs (`baseline.txt`), rewritten with the new measurements by `--save-baseline=1`;
+/// `--max-regression=<percent>` the largest accepted drop of throughput below the baseline (10 by default);
+/// `--perf-size=<cells>`, `--perf-generations=<count>`, `--repeats=<count>` the soup the throughput is measured on.
+/// Engine options such as `--threads` or `--rebalance-interval` are passed to the engines.
+int main(int argc, char **argv)
+{
+	Settings settings;
+	settings.perfSize = stoi(getOption(argc, argv, "perf-size", to_string(settings.perfSize), 1));
+	settings.perfGenerations = stoi(getOption(argc, argv, "perf-generations", to_string(settings.perfGenerations), 1));
+	settings.repeats = max(1, stoi(getOption(argc, argv, "repeats", to_string(settings.repeats), 1)));
+#ifdef HAVE_MPI
+	if (getOption(argc, argv, "worker", "", 1) == "mpi")
+	{
+		return runWorker(argc, argv, settings);
+	}
+#endif
+
+	string defaultEngines;
+	for (const auto &[name, factory] : engineRegistry())
+	{
+		if (name != "mpi")
+			defaultEngines += (defaultEngines.empty() ? "" : ",") + name;
+	}
+	const vector<string> engines = splitList(getOption(argc, argv, "engines", defaultEngines, 1));
+	const string baselinePath = getOption(argc, argv, "baseline", "baseline.txt", 1);
+	const double maxRegression = stod(getOption(argc, argv, "max-regression", "10", 1));
+	const EngineOptions options = [argc, argv](const string &name, const string &defaultValue)
+	{ return getOption(argc, argv, name, defaultValue, 1); };
+
+	vector<Result> results;
+	try
+	{
+		const vector<Pattern> corpus = makeCorpus();
+		vector<vector<Snapshot>> expected;
+		for (const Pattern &pattern : corpus)
+		{
+			expected.push_back(computeExpected(pattern));
+		}
+		for (const string &engine : engines)
+		{
+			results.push_back(runEngine(engine, engine, options, settings, corpus, expected));
+		}
+#ifdef HAVE_MPI
+		for (const string &ranks : splitList(getOption(argc, argv, "mpi-ranks", "2,4", 1)))
+		{
+			results.push_back(launchMpi(getOption(argc, argv, "mpirun", "mpirun", 1), stoi(ranks), argc, argv));
+		}
+#endif
+	}
+	catch (const exception &error)
+	{
+		cout << error.what() << "\n";
+		cout << "Verification did not complete";
+		return 1;
+	}
+
+	bool passed = true;
+	const map<string, double> baseline = loadBaseline(baselinePath);
+	cout << "\n" << fixed << setprecision(1);
+	for (const Result &result : results)
+	{
+		if (!result.completed)
+		{
+			cout << result.engine << ": did not complete\n";
+			passed = false;
+			continue;
+		}
+		cout << result.engine << ": " << (result.failures == 0 ? "matches the reference" : to_string(result.failures) + " patterns differ from the reference");
+		passed = passed && result.failures == 0;
+		const auto it = baseline.find(result.engine);
+		if (it == baseline.end())
+		{
+			cout << ", no baseline throughput\n";
+			continue;
+		}
+		const double change = (result.cellsPerSecond / it->second - 1) * 100;
+		cout << ", throughput " << showpos << change << noshowpos << "% against the baseline";
+		if (change < -maxRegression)
+		{
+			cout << " (regression above " << maxRegression << "%)";
+			passed = false;
+		}
+		cout << "\n";
+	}
+	if (getOption(argc, argv, "save-baseline", "0", 1) == "1")
+	{
+		saveBaseline(baselinePath, baseline, results);
+		cout << "Baseline saved in " << baselinePath << "\n";
+	}
+	cout << (passed ? "Verification passed" : "Verification failed");
+	return passed ? 0 : 1;
+}